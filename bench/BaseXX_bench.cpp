@@ -0,0 +1,535 @@
+/// ============================================================================
+/// BaseXX_bench.cpp
+/// ----------------------------------------------------------------------------
+/// Throughput of every codec & alphabet, encode and decode, from 8 B to 1 GiB.
+///
+///     BaseXX_Bench [--filter TEXT] [--min-size N] [--max-size N]
+///                  [--min-time SEC] [--repeat N]
+///                  [--json FILE] [--baseline FILE]
+///
+/// Each case is timed `repeat` times for at least `min-time` seconds and the
+/// fastest run is kept. Sizes accept K/M/G suffixes (powers of 1024). The
+/// SIMD level is the library default; set BASEXX_SIMD_LEVEL to force one.
+/// Results go to stdout as a table and, with --json, to FILE ("-": stdout).
+/// --baseline reads a file written by --json and prints the change of each
+/// case against it.
+/// ============================================================================
+
+#include "BaseXX.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(BASEXX_X86_SIMD)
+    #if defined(_MSC_VER)
+        #define BASEXX_BENCH_TSC() __rdtsc()
+    #else  // defined(_MSC_VER)
+        #include <x86intrin.h>  // __rdtsc
+        #define BASEXX_BENCH_TSC() __rdtsc()
+    #endif  // defined(_MSC_VER)
+#endif  // defined(BASEXX_X86_SIMD)
+
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        std::string filter{};
+        size_t min_size = 8;
+        size_t max_size = size_t(1) << 30;
+        double min_time = 0.1;  // seconds per run
+        size_t repeat = 5;
+        const char* json_path = nullptr;
+        const char* baseline_path = nullptr;
+    };
+
+    /// One codec & alphabet. `encode` and `decode` run on caller buffers
+    /// and return the number of characters / bytes written; `decode` is
+    /// nullptr for encode-only layouts.
+    struct Codec
+    {
+        const char* name;
+        size_t (*encoded_length)(size_t len);
+        size_t (*encode)(char* dst, size_t cap, const char* src, size_t len);
+        size_t (*decode)(char* dst, size_t cap, const char* src, size_t len);
+    };
+
+    template <typename Alphabet>
+    size_t encode64(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base64::encode_into(dst, cap, src, len, Alphabet::encoding());
+    }
+
+    template <typename Alphabet>
+    size_t decode64(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base64::decode_into<Alphabet>(dst, cap, src, len);
+    }
+
+    size_t encode64_mime(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base64::encode_wrapped_into(dst, cap, src, len);
+    }
+
+    size_t decode64_mime(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base64::decode_lenient_into(dst, cap, src, len);
+    }
+
+    template <typename Alphabet>
+    size_t encode32(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base32::encode_into(dst, cap, src, len, Alphabet::encoding());
+    }
+
+    template <typename Alphabet>
+    size_t decode32(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base32::decode_into<Alphabet>(dst, cap, src, len);
+    }
+
+    size_t encode16(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base16::encode_into(dst, cap, src, len);
+    }
+
+    size_t decode16(char* dst, size_t cap, const char* src, size_t len)
+    {
+        return base16::decode_into(dst, cap, src, len);
+    }
+
+    size_t encoded_length64(size_t len)
+    {
+        return base64::encoded_length(len);
+    }
+
+    size_t wrapped_length64(size_t len)
+    {
+        return base64::wrapped_length(len, base64::mime_wrap);
+    }
+
+    size_t encoded_length32(size_t len)
+    {
+        return base32::encoded_length(len);
+    }
+
+    size_t encoded_length16(size_t len)
+    {
+        return base16::encoded_length(len);
+    }
+
+    const Codec codecs[] = {
+        { "base64", &encoded_length64,
+            &encode64<base64::StandardAlphabet>,
+            &decode64<base64::StandardAlphabet> },
+        { "base64url", &encoded_length64,
+            &encode64<base64::UrlSafeAlphabet>,
+            &decode64<base64::UrlSafeAlphabet> },
+        { "base64mime", &wrapped_length64,
+            &encode64_mime, &decode64_mime },
+        { "base32", &encoded_length32,
+            &encode32<base32::StandardAlphabet>,
+            &decode32<base32::StandardAlphabet> },
+        { "base32hex", &encoded_length32,
+            &encode32<base32::HexAlphabet>,
+            &decode32<base32::HexAlphabet> },
+        { "base16", &encoded_length16, &encode16, &decode16 },
+    };
+
+    struct Result
+    {
+        std::string name;  // codec/op/size
+        size_t size = 0;   // raw bytes per call
+        double ns_per_call = 0;
+        double gb_per_s = 0;
+        double cycles_per_byte = -1;  // < 0: no cycle counter
+    };
+
+    /// Keeps results alive so the timed calls can't be optimized out.
+    volatile size_t sink = 0;
+
+    bool parse_size(const char* text, size_t& value)
+    {
+        char* end = nullptr;
+        const double parsed = std::strtod(text, &end);
+        if (end == text || parsed < 0)
+        {
+            return false;
+        }
+
+        double scale = 1;
+        switch (*end)
+        {
+        case 'k': case 'K': scale = 1024.0; end++; break;
+        case 'm': case 'M': scale = 1024.0 * 1024; end++; break;
+        case 'g': case 'G': scale = 1024.0 * 1024 * 1024; end++; break;
+        default: break;
+        }
+        if (*end != '\0')
+        {
+            return false;
+        }
+
+        value = static_cast<size_t>(parsed * scale);
+        return true;
+    }
+
+    bool parse_args(int argc, char* argv[], Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg{ argv[i] };
+            const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+            if (value == nullptr)
+            {
+                return false;
+            }
+            i++;
+
+            if (arg == "--filter")
+            {
+                options.filter = value;
+            }
+            else if (arg == "--min-size")
+            {
+                if (!parse_size(value, options.min_size))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--max-size")
+            {
+                if (!parse_size(value, options.max_size))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "--min-time")
+            {
+                options.min_time = std::atof(value);
+            }
+            else if (arg == "--repeat")
+            {
+                options.repeat = std::strtoul(value, nullptr, 10);
+                options.repeat = (options.repeat > 0) ? options.repeat : 1;
+            }
+            else if (arg == "--json")
+            {
+                options.json_path = value;
+            }
+            else if (arg == "--baseline")
+            {
+                options.baseline_path = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string make_input(const size_t len)
+    {
+        std::string data(len, '\0');
+        uint32_t state = 0x9E3779B9u;
+        for (auto& c : data)
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            c = static_cast<char>(state);
+        }
+
+        return data;
+    }
+
+    /// Fastest of `repeat` runs, each calling `func` until `min_time` passed.
+    template <typename Func>
+    Result measure(const Options& options, const std::string& name,
+        const size_t size, const Func& func)
+    {
+        // Calibrate: double the batch until it takes 1/10 of min_time.
+        size_t batch = 1;
+        while (true)
+        {
+            const Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < batch; i++)
+            {
+                sink = sink + func();
+            }
+            const double elapsed =
+                std::chrono::duration<double>(Clock::now() - start).count();
+            if (elapsed * 10 >= options.min_time || batch >= (1u << 30))
+            {
+                break;
+            }
+            batch *= 2;
+        }
+
+        Result result{};
+        result.name = name;
+        result.size = size;
+        result.ns_per_call = 1e300;
+
+        for (size_t run = 0; run < options.repeat; run++)
+        {
+            size_t calls = 0;
+            double elapsed = 0;
+            uint64_t cycles = 0;
+            const Clock::time_point start = Clock::now();
+#if defined(BASEXX_BENCH_TSC)
+            const uint64_t tsc_start = BASEXX_BENCH_TSC();
+#endif  // defined(BASEXX_BENCH_TSC)
+            do
+            {
+                for (size_t i = 0; i < batch; i++)
+                {
+                    sink = sink + func();
+                }
+                calls += batch;
+                elapsed = std::chrono::duration<double>(
+                    Clock::now() - start).count();
+            } while (elapsed < options.min_time);
+#if defined(BASEXX_BENCH_TSC)
+            cycles = BASEXX_BENCH_TSC() - tsc_start;
+#endif  // defined(BASEXX_BENCH_TSC)
+
+            const double ns_per_call = elapsed * 1e9 / calls;
+            if (ns_per_call < result.ns_per_call)
+            {
+                result.ns_per_call = ns_per_call;
+                result.gb_per_s = size / ns_per_call;
+#if defined(BASEXX_BENCH_TSC)
+                result.cycles_per_byte =
+                    static_cast<double>(cycles) / calls / size;
+#else  // defined(BASEXX_BENCH_TSC)
+                (void)cycles;
+#endif  // defined(BASEXX_BENCH_TSC)
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<Result> run(const Options& options)
+    {
+        std::vector<size_t> sizes{};
+        for (size_t size = 8; size <= (size_t(1) << 30); size *= 8)
+        {
+            if (size >= options.min_size && size <= options.max_size)
+            {
+                sizes.push_back(size);
+            }
+        }
+
+        const auto wanted = [&options](const std::string& name)
+        {
+            return name.find(options.filter) != std::string::npos;
+        };
+
+        std::vector<Result> results{};
+        for (const size_t size : sizes)
+        {
+            // Don't allocate gigabytes for cases that are filtered out
+            bool any = false;
+            for (const Codec& codec : codecs)
+            {
+                const std::string prefix{ std::string(codec.name) + "/" };
+                const std::string suffix{ "/" + std::to_string(size) };
+                any = any || wanted(prefix + "encode" + suffix) ||
+                      wanted(prefix + "decode" + suffix);
+            }
+            if (!any)
+            {
+                continue;
+            }
+
+            const std::string data{ make_input(size) };
+            std::string encoded{};
+            std::string decoded(size, '\0');
+
+            for (const Codec& codec : codecs)
+            {
+                encoded.resize(codec.encoded_length(size));
+                codec.encode(&encoded[0], encoded.size(), data.data(), size);
+
+                const std::string prefix{ std::string(codec.name) + "/" };
+                const std::string suffix{ "/" + std::to_string(size) };
+                const std::string encode_name{ prefix + "encode" + suffix };
+                const std::string decode_name{ prefix + "decode" + suffix };
+
+                if (wanted(encode_name))
+                {
+                    results.push_back(measure(options, encode_name, size,
+                        [&]()
+                        {
+                            return codec.encode(&encoded[0], encoded.size(),
+                                data.data(), size);
+                        }));
+                }
+                if (codec.decode && wanted(decode_name))
+                {
+                    results.push_back(measure(options, decode_name, size,
+                        [&]()
+                        {
+                            return codec.decode(&decoded[0], decoded.size(),
+                                encoded.data(), encoded.size());
+                        }));
+                }
+            }
+        }
+
+        return results;
+    }
+
+    /// gb_per_s of every case in a file written by write_json().
+    std::map<std::string, double> read_baseline(const char* path)
+    {
+        std::map<std::string, double> baseline{};
+        std::ifstream file{ path };
+        std::string line{};
+        while (std::getline(file, line))
+        {
+            const size_t name = line.find("\"name\": \"");
+            const size_t gbps = line.find("\"gb_per_s\": ");
+            if (name == std::string::npos || gbps == std::string::npos)
+            {
+                continue;
+            }
+
+            const size_t first = name + 9;
+            const size_t last = line.find('"', first);
+            baseline[line.substr(first, last - first)] =
+                std::atof(line.c_str() + gbps + 12);
+        }
+
+        return baseline;
+    }
+
+    void print_table(const std::vector<Result>& results,
+        const std::map<std::string, double>& baseline)
+    {
+        std::printf("simd level: %s\n\n",
+            BaseXX::simd_level_name(BaseXX::simd_level()));
+        std::printf("%-32s %14s %10s %12s%s\n", "case", "ns/call", "GB/s",
+            "cycles/byte", baseline.empty() ? "" : "   vs baseline");
+
+        for (const Result& result : results)
+        {
+            std::printf("%-32s %14.1f %10.3f ", result.name.c_str(),
+                result.ns_per_call, result.gb_per_s);
+            if (result.cycles_per_byte >= 0)
+            {
+                std::printf("%12.3f", result.cycles_per_byte);
+            }
+            else
+            {
+                std::printf("%12s", "-");
+            }
+
+            const auto found = baseline.find(result.name);
+            if (found != baseline.end() && found->second > 0)
+            {
+                std::printf("   %+7.1f%%",
+                    (result.gb_per_s / found->second - 1) * 100);
+            }
+            std::printf("\n");
+        }
+    }
+
+    /// One result per line, so read_baseline() and line-based diff tools
+    /// can read it back without a JSON parser.
+    std::string to_json(const std::vector<Result>& results)
+    {
+        std::ostringstream out{};
+        out.precision(6);
+        out << "{\n";
+        out << "  \"simd_level\": \""
+            << BaseXX::simd_level_name(BaseXX::simd_level()) << "\",\n";
+        out << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& result = results[i];
+            out << "    { \"name\": \"" << result.name << "\""
+                << ", \"size\": " << result.size
+                << ", \"ns_per_call\": " << result.ns_per_call
+                << ", \"gb_per_s\": " << result.gb_per_s
+                << ", \"cycles_per_byte\": ";
+            if (result.cycles_per_byte >= 0)
+            {
+                out << result.cycles_per_byte;
+            }
+            else
+            {
+                out << "null";
+            }
+            out << " }" << ((i + 1 < results.size()) ? "," : "") << "\n";
+        }
+        out << "  ]\n";
+        out << "}\n";
+
+        return out.str();
+    }
+}  // namespace
+
+
+int main(int argc, char* argv[])
+{
+    Options options{};
+    if (!parse_args(argc, argv, options))
+    {
+        std::fputs("Usage: BaseXX_Bench [--filter TEXT] [--min-size N] "
+            "[--max-size N] [--min-time SEC]\n"
+            "                    [--repeat N] [--json FILE] "
+            "[--baseline FILE]\n", stderr);
+        return EXIT_FAILURE;
+    }
+
+    std::map<std::string, double> baseline{};
+    if (options.baseline_path != nullptr)
+    {
+        baseline = read_baseline(options.baseline_path);
+        if (baseline.empty())
+        {
+            std::fprintf(stderr, "BaseXX_Bench: no results in %s\n",
+                options.baseline_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::vector<Result> results{ run(options) };
+
+    if (options.json_path != nullptr &&
+        std::strcmp(options.json_path, "-") == 0)
+    {
+        std::fputs(to_json(results).c_str(), stdout);
+        return EXIT_SUCCESS;
+    }
+
+    print_table(results, baseline);
+
+    if (options.json_path != nullptr)
+    {
+        std::ofstream file{ options.json_path };
+        file << to_json(results);
+        if (!file)
+        {
+            std::fprintf(stderr, "BaseXX_Bench: can't write %s\n",
+                options.json_path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -11,21 +11,36 @@
 /// namespace BaseXX
 /// {
 ///     // Common functions, enums, and type definitions
+///     // Runtime CPU dispatch
+///     // Codec engine: Codec<Alphabet, BitsPerChar, Padding>
 ///     namespace _64_
 ///     {
 ///         // Base64[-URLsafe] encoding & decoding implementations
+///         // SIMD kernels
+///         // Parallel encoding & decoding
+///         // Columnar batch encoding & decoding
+///         // Streaming encoder & decoder
 ///         // Helper functions
 ///     }
 ///     namespace _32_
 ///     {
 ///         // Base32[-Hex] encoding & decoding implementations
+///         // SIMD kernels
+///         // Parallel encoding & decoding
+///         // Columnar batch encoding & decoding
+///         // Streaming encoder & decoder
 ///         // Helper functions
 ///     }
 ///     namespace _16_
 ///     {
 ///         // Base16 encoding & decoding implementations
+///         // SIMD kernels
+///         // Parallel encoding & decoding
+///         // Columnar batch encoding & decoding
+///         // Streaming decoder
 ///         // Helper functions
 ///     }
+///     // Custom alphabets chosen at run time
 /// }
 /// using base64 = ::BaseXX::_64_;
 /// using base32 = ::BaseXX::_32_;
@@ -39,15 +54,73 @@
 #define BASEXX_H
 
 
+#include <array>
+#include <atomic>
 #include <cstdint>  // uint8_t
+#include <cstdio>  // std::fputs
+#include <cstdlib>  // std::getenv, std::abort
+#include <cstring>  // memcpy, memset, memcmp
+#include <initializer_list>
 #include <stdexcept>  // std::runtime_error
 #include <string>
+#include <type_traits>  // std::enable_if
+#include <utility>  // std::declval, std::index_sequence
 #include <vector>
 #if __cplusplus >= 201703L
     #include <string_view>
 #endif  // __cplusplus >= 201703L
 
-#define FALLTHROUGH do{} while (false)
+/// The *_parallel functions split large inputs across std::thread workers.
+/// Define BASEXX_NO_THREADS to keep them on the calling thread.
+#if !defined(BASEXX_NO_THREADS)
+    #include <thread>
+#endif  // !defined(BASEXX_NO_THREADS)
+
+/// SIMD kernels are compiled for x86 regardless of -march and picked at run
+/// time (see BaseXX::simd_level()). Define BASEXX_NO_SIMD to leave them out.
+#if (defined(__x86_64__) || defined(_M_X64) || \
+     defined(__i386__) || defined(_M_IX86)) && !defined(BASEXX_NO_SIMD)
+    #define BASEXX_X86_SIMD
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>  // __cpuidex, _xgetbv
+    #else  // defined(_MSC_VER)
+        #include <cpuid.h>  // __cpuid_count
+    #endif  // defined(_MSC_VER)
+#endif  // x86 && !defined(BASEXX_NO_SIMD)
+
+#if defined(BASEXX_X86_SIMD) && (defined(__GNUC__) || defined(__clang__))
+    #define BASEXX_TARGET_SSE41 __attribute__((target("ssse3,sse4.1")))
+    #define BASEXX_TARGET_AVX2 __attribute__((target("avx2,bmi2")))
+    #define BASEXX_TARGET_AVX512 \
+        __attribute__((target("avx512f,avx512bw,avx512vl,bmi2")))
+#else  // MSVC accepts any intrinsic without a target attribute
+    #define BASEXX_TARGET_SSE41
+    #define BASEXX_TARGET_AVX2
+    #define BASEXX_TARGET_AVX512
+#endif  // defined(BASEXX_X86_SIMD) && (defined(__GNUC__) || ...)
+
+/// With exceptions disabled (-fno-exceptions) the throwing API aborts after
+/// printing its message; the try_* functions never get there.
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+    #define BASEXX_EXCEPTIONS
+#endif  // defined(__cpp_exceptions) || ...
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+    #if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        #define BASEXX_BIG_ENDIAN
+    #endif  // __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#endif  // defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+
+#if __cplusplus >= 201703L
+    #define FALLTHROUGH [[fallthrough]]
+#elif defined(__clang__)
+    #define FALLTHROUGH [[clang::fallthrough]]
+#elif defined(__GNUC__) && __GNUC__ >= 7
+    #define FALLTHROUGH [[gnu::fallthrough]]
+#else
+    #define FALLTHROUGH do{} while (false)
+#endif
 
 namespace BaseXX
 {
@@ -70,8 +143,42 @@ namespace BaseXX
         InvalidCharacter    = InvalidBase + 2,  // 12
         InvalidEncodedType  = InvalidBase + 3,  // 13
         InvalidPaddingCount = InvalidBase + 4,  // 14
+        InvalidBufferSize   = InvalidBase + 5,  // 15
+        InvalidAlphabet     = InvalidBase + 6,  // 16
+    };
+
+    /// Trailing '=' padding of Base64 & Base32. Encoders write it only when
+    /// it is Required; decoders take an unpadded last group unless it is.
+    enum class ePadding
+    {
+        Required = 0,  // RFC 4648: padded output, whole groups only
+        Optional = 1,  // unpadded output, padded or unpadded input
+        None     = 2,  // unpadded output and input, e.g. JWT (RFC 7515)
     };
 
+    inline const char* result_message(eResultCode code)
+    {
+        switch (code)
+        {
+        case eResultCode::Success:
+            return "Success.";
+        case eResultCode::InvalidLength:
+            return "Invalid encoded text length.";
+        case eResultCode::InvalidPaddingCount:
+            return "Invalid encoded padding count.";
+        case eResultCode::InvalidCharacter:
+            return "Invalid encoded character.";
+        case eResultCode::InvalidEncodedType:
+            return "Invalid encoded type.";
+        case eResultCode::InvalidBufferSize:
+            return "Output buffer is too small.";
+        case eResultCode::InvalidAlphabet:
+            return "Invalid alphabet.";
+        default:
+            return "Invalid encoded text.";
+        }
+    }
+
     [[noreturn]]
     inline void throwRuntimeError(
         eResultCode code, StringType caller_info, StringType msg = "")
@@ -86,871 +193,7272 @@ namespace BaseXX
         }
         else
         {
-            switch (code)
-            {
-            case eResultCode::InvalidLength:
-                error_message += "Invalid encoded text length.";
-                break;
-            case eResultCode::InvalidPaddingCount:
-                error_message += "Invalid encoded padding count.";
-                break;
-            case eResultCode::InvalidCharacter:
-                error_message += "Invalid encoded character.";
-                break;
-            case eResultCode::InvalidEncodedType:
-                error_message += "Invalid encoded type.";
-                break;
-            default:
-                error_message += "Invalid encoded text.";
-                break;
-            }
+            error_message += result_message(code);
         }
 
+#if defined(BASEXX_EXCEPTIONS)
         throw std::runtime_error(error_message);
+#else  // defined(BASEXX_EXCEPTIONS)
+        std::fputs(error_message.c_str(), stderr);
+        std::fputs("\n", stderr);
+        std::abort();
+#endif  // defined(BASEXX_EXCEPTIONS)
     }
 
-namespace _64_
-{
-    /// ========================================================================
-    /// Base64[-URLsafe] Encoding/Decoding Implementation
-    /// ========================================================================
+    /// Same as above, reporting the offset of the offending character.
+    [[noreturn]]
+    inline void throwRuntimeError(
+        eResultCode code, StringType caller_info, const size_t offset)
+    {
+        std::string msg{ result_message(code) };
+        msg += " (offset: ";
+        msg += std::to_string(offset);
+        msg += ")";
 
-    /// The Base 64 Alphabet Table
-    /// https://datatracker.ietf.org/doc/html/rfc4648#section-4
-    ///
-    static constexpr uint8_t encoding_table[64] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
-        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
-        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 24 ~ 31
-        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 32 ~ 39
-        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 40 ~ 47
-        'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 48 ~ 55
-        '4', '5', '6', '7', '8', '9', '+', '/',  // 56 ~ 63
-    };
+        throwRuntimeError(code, caller_info, msg);
+    }
 
-    /// The Base 64 Alphabet Table (URL and Filename safe)
-    /// https://datatracker.ietf.org/doc/html/rfc4648#section-5
-    ///
-    static constexpr uint8_t urlsafe_encoding_table[64] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
-        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
-        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
-        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 24 ~ 31
-        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 32 ~ 39
-        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 40 ~ 47
-        'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 48 ~ 55
-        '4', '5', '6', '7', '8', '9', '-', '_',  // 56 ~ 63
-    };
+    /// Value returned by the *_value() lookups for characters outside the
+    /// alphabet.
+    constexpr uint8_t invalid_value = 0xFF;
 
-    inline eResultCode check_format(
-        const char* encoded_text, const size_t text_len)
+    /// 256-entry reverse lookup of an alphabet, generated at compile time.
+    /// Characters outside the alphabet map to invalid_value.
+    struct DecodeTable
     {
-        if (text_len % 4 != 0)
-        {
-            return eResultCode::InvalidLength;
-        }
+        uint8_t values[256];
 
-        size_t idx = text_len - 1;
-        size_t padding_cnt = 0;
-        while (true)
+        constexpr uint8_t operator()(const char c) const
         {
-            if (padding_cnt > 2)
-            {
-                return eResultCode::InvalidPaddingCount;
-            }
-
-            if (encoded_text[idx] != '=')
-            {
-                break;
-            }
-
-            idx--;
-            padding_cnt++;
+            return values[static_cast<uint8_t>(c)];
         }
+    };
 
-        return eResultCode::Success;
-    }
-
-    inline const uint8_t decode_char(const char c)
+    constexpr DecodeTable make_decode_table(
+        const uint8_t* alphabet, const size_t size)
     {
-        if (c >= 'A' && c <= 'Z')
-        {
-            return c - 'A';
-        }
-        else if (c >= 'a' && c <= 'z')
-        {
-            return 26 + (c - 'a');
-        }
-        else if (c >= '0' && c <= '9')
-        {
-            return 52 + (c - '0');
-        }
-        else if (c == '+')
+        DecodeTable table{};
+        for (size_t i = 0; i < 256; i++)
         {
-            return 62;
+            table.values[i] = invalid_value;
         }
-        else if (c == '/')
+        for (size_t i = 0; i < size; i++)
         {
-            return 63;
+            table.values[alphabet[i]] = static_cast<uint8_t>(i);
         }
 
-        throwRuntimeError(eResultCode::InvalidCharacter, __FUNCTION__);
+        return table;
     }
 
-    inline const uint8_t urlsafe_decode_char(const char c)
+    template <size_t N>
+    constexpr DecodeTable make_decode_table(const uint8_t (&alphabet)[N])
     {
-        if (c >= 'A' && c <= 'Z')
-        {
-            return c - 'A';
-        }
-        else if (c >= 'a' && c <= 'z')
-        {
-            return 26 + (c - 'a');
-        }
-        else if (c >= '0' && c <= '9')
+        return make_decode_table(alphabet, N);
+    }
+
+    /// Table accepting the characters of both `a` and `b` (`a` wins).
+    constexpr DecodeTable merge_decode_tables(
+        const DecodeTable& a, const DecodeTable& b)
+    {
+        DecodeTable table{};
+        for (size_t i = 0; i < 256; i++)
         {
-            return 52 + (c - '0');
+            table.values[i] =
+                (a.values[i] != invalid_value) ? a.values[i] : b.values[i];
         }
-        else if (c == '-')
+
+        return table;
+    }
+
+    /// Outcome of the non-throwing try_decode*() functions.
+    struct DecodeResult
+    {
+        eResultCode code = eResultCode::Success;
+        size_t offset = 0;   // first offending character, on failure
+        size_t written = 0;  // bytes written, also the good prefix on failure
+
+        explicit operator bool() const noexcept
         {
-            return 62;
+            return code == eResultCode::Success;
         }
-        else if (c == '_')
+    };
+
+    /// Result for a text rejected by check_format(): points at the trailing
+    /// padding run, or at the incomplete last group.
+    inline DecodeResult format_error(eResultCode code,
+        const char* encoded_text, const size_t text_len, const size_t group)
+    {
+        size_t offset = text_len / group * group;
+        if (code == eResultCode::InvalidPaddingCount)
         {
-            return 63;
+            offset = text_len;
+            while (offset > 0 && encoded_text[offset - 1] == '=')
+            {
+                offset--;
+            }
         }
 
-        throwRuntimeError(eResultCode::InvalidCharacter, __FUNCTION__);
+        return DecodeResult{ code, offset, 0 };
     }
-    
-    inline std::string encode_base(const char* data,
-        const size_t data_len, const uint8_t* table = encoding_table)
+
+    /// Throwing counterpart of a failed DecodeResult.
+    [[noreturn]]
+    inline void throwDecodeError(
+        const DecodeResult& result, StringType caller_info)
     {
-        std::string encoded{};
-        encoded.reserve(data_len * 4 / 3);
+        if (result.code == eResultCode::InvalidBufferSize)
+        {
+            throwRuntimeError(result.code, caller_info);
+        }
 
-        uint8_t decoded_data_3[3] = {0,};
-        uint8_t encoded_data_4[4] = {0,};
+        throwRuntimeError(result.code, caller_info, result.offset);
+    }
 
-        size_t i = 0;
-        for (size_t pos = 0; pos < data_len; pos++)
-        {
-            decoded_data_3[i++] = data[pos];
-            if (i == 3)
-            {
-                encoded_data_4[0] = (decoded_data_3[0] & 0xFC) >> 2;
 
-                encoded_data_4[1] = ((decoded_data_3[0] & 0x03) << 4) |
-                                    ((decoded_data_3[1] & 0xF0) >> 4);
+    /// ========================================================================
+    /// Parallel Slicing
+    /// ------------------------------------------------------------------------
+    /// Large inputs are cut at group boundaries into one slice per thread.
+    /// Every slice knows where its output starts, so the workers write
+    /// straight into the shared output buffer and nothing is merged after.
+    /// ========================================================================
 
-                encoded_data_4[2] = ((decoded_data_3[1] & 0x0F) << 2) |
-                                    ((decoded_data_3[2] & 0xC0) >> 6);
+    /// Smallest input share (bytes or characters) worth a thread of its own.
+    constexpr size_t parallel_min_slice = 1 << 20;
 
-                encoded_data_4[3] = decoded_data_3[2] & 0x3F;
+    /// Number of slices for `len` bytes or characters on at most `threads`
+    /// threads (0: one per hardware thread). 1 means no worker is started.
+    inline size_t parallel_slices(const size_t len, size_t threads)
+    {
+#if defined(BASEXX_NO_THREADS)
+        (void)len;
+        (void)threads;
 
-                for (const auto& c : encoded_data_4)
-                {
-                    encoded.push_back(table[c]);
-                }
+        return 1;
+#else  // defined(BASEXX_NO_THREADS)
+        if (threads == 0)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
 
-                i = 0;
-            }
+        const size_t max_slices = len / parallel_min_slice;
+        if (threads > max_slices)
+        {
+            threads = max_slices;
         }
 
-        if (i)  // i == 1 or i == 2
+        return (threads > 1) ? threads : 1;
+#endif  // defined(BASEXX_NO_THREADS)
+    }
+
+    /// Call `func(first, last)` for `slices` near-equal ranges of
+    /// [0, groups). The calling thread handles the last range itself.
+    template <typename Func>
+    inline void parallel_for(
+        const size_t groups, const size_t slices, const Func& func)
+    {
+#if !defined(BASEXX_NO_THREADS)
+        struct Workers
         {
-            memset(decoded_data_3 + i, 0x00, 3 - i);
+            std::vector<std::thread> threads;
 
-            switch (i)
+            ~Workers()
             {
-            case 2:
-                encoded_data_4[2] = (decoded_data_3[1] & 0x0F) << 2;
-                FALLTHROUGH;
-            case 1:
-                encoded_data_4[1] = ((decoded_data_3[0] & 0x03) << 4) |
-                                    ((decoded_data_3[1] & 0xF0) >> 4);
-                encoded_data_4[0] = (decoded_data_3[0] & 0xFC) >> 2;
-                FALLTHROUGH;
-            default:
-                break;
+                for (auto& worker : threads)
+                {
+                    worker.join();
+                }
             }
+        } workers;
+        workers.threads.reserve(slices - 1);
 
-            for (size_t j = 0; j < i + 1; j++)
-            {
-                encoded.push_back(table[encoded_data_4[j]]);
-            }
+        const size_t share = groups / slices;
+        const size_t extra = groups % slices;
 
-            size_t padding_cnt = 4 - (encoded.length() % 4);
-            while (padding_cnt-- != 0)
+        size_t first = 0;
+        for (size_t i = 0; i + 1 < slices; i++)
+        {
+            const size_t last = first + share + ((i < extra) ? 1 : 0);
+            workers.threads.emplace_back([&func, first, last]()
             {
-                encoded.push_back('=');
-            }
+                func(first, last);
+            });
+            first = last;
         }
 
-        return encoded;
+        func(first, groups);
+#else  // !defined(BASEXX_NO_THREADS)
+        (void)slices;
+
+        func(0, groups);
+#endif  // !defined(BASEXX_NO_THREADS)
     }
 
-    inline std::string decode_base(const char* data,
-        const size_t data_len,
-        const uint8_t (*decode_char_func)(const char) = &decode_char)
+    /// Encode `data` in `slices` slices of whole `BytesPerGroup` groups;
+    /// `encode` is the encode_into() of the codec. The last slice also takes
+    /// the partial group, so only its output carries padding.
+    template <size_t BytesPerGroup, size_t CharsPerGroup, typename EncodeFunc>
+    inline void encode_slices(char* dst, const size_t encoded_len,
+        const char* data, const size_t data_len, const size_t slices,
+        const EncodeFunc& encode)
     {
-        eResultCode code = check_format(data, data_len);
-        if (code != eResultCode::Success)
+        const size_t groups = data_len / BytesPerGroup;
+
+        parallel_for(groups, slices, [&](size_t first, size_t last)
         {
-             throwRuntimeError(code, __FUNCTION__);
+            const size_t src_pos = first * BytesPerGroup;
+            const size_t dst_pos = first * CharsPerGroup;
+            const size_t src_len = (last == groups)
+                ? data_len - src_pos
+                : (last - first) * BytesPerGroup;
+
+            encode(dst + dst_pos, encoded_len - dst_pos,
+                data + src_pos, src_len);
+        });
+    }
+
+    /// Decode `data` in `slices` slices of whole `CharsPerGroup` groups;
+    /// `decode` is the try_decode_into() of the codec and must not throw.
+    /// Any slice but the last one has to decode completely. If one fails,
+    /// the whole text is decoded again on the calling thread, so errors
+    /// come out exactly as from try_decode_into().
+    template <size_t CharsPerGroup, size_t BytesPerGroup, typename DecodeFunc>
+    inline DecodeResult decode_slices(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t decoded_len,
+        const size_t slices, const DecodeFunc& decode)
+    {
+        if (slices <= 1)
+        {
+            return decode(dst, dst_cap, data, data_len);
         }
 
-        std::string decoded{};
-        decoded.reserve(data_len * 3 / 4);
+        // Length & padding errors come first, before any thread is started.
+        const DecodeResult format = decode(nullptr, 0, data, data_len);
+        if (format.code != eResultCode::InvalidBufferSize ||
+            dst_cap < decoded_len)
+        {
+            return format;
+        }
 
-        uint8_t encoded_data_4[4] = { 0, };
-        uint8_t decoded_data_3[3] = { 0, };
+        const size_t groups = data_len / CharsPerGroup;
+        std::atomic<bool> failed{ false };
 
-        size_t i = 0;
-        for (size_t pos = 0; pos < data_len; pos++)
+        parallel_for(groups, slices, [&](size_t first, size_t last)
         {
-            if (data[pos] == '=')
+            const size_t src_pos = first * CharsPerGroup;
+            const size_t dst_pos = first * BytesPerGroup;
+            const DecodeResult result = decode(dst + dst_pos,
+                dst_cap - dst_pos, data + src_pos,
+                (last - first) * CharsPerGroup);
+
+            if (!result || (last != groups &&
+                            result.written != (last - first) * BytesPerGroup))
             {
-                break;
+                failed = true;
             }
+        });
 
-            encoded_data_4[i++] = decode_char_func(data[pos]);
+        if (failed)
+        {
+            return decode(dst, dst_cap, data, data_len);
+        }
 
-            if (i == 4)
-            {
-                decoded_data_3[0] = ((encoded_data_4[0] & 0x3F) << 2) |
-                                    ((encoded_data_4[1] & 0x30) >> 4);
+        return DecodeResult{ eResultCode::Success, 0, decoded_len };
+    }
 
-                decoded_data_3[1] = ((encoded_data_4[1] & 0x0F) << 4) |
-                                    ((encoded_data_4[2] & 0x3C) >> 2);
 
-                decoded_data_3[2] = ((encoded_data_4[2] & 0x03) << 6) |
-                                    encoded_data_4[3];
+    /// ========================================================================
+    /// Byte Ranges
+    /// ------------------------------------------------------------------------
+    /// ByteView is the one input type of the encode() & decode() front end:
+    /// it binds to pointer+length, NUL-terminated strings, braced byte lists
+    /// and any contiguous range of 1-byte elements (std::string,
+    /// std::string_view, std::array, std::vector<std::byte>, std::span, ...)
+    /// without copying.
+    /// ========================================================================
 
-                for (const auto& c : decoded_data_3)
-                {
-                    decoded.push_back(c);
-                }
+    template <typename Range>
+    using range_element_t = typename std::remove_pointer<
+        decltype(std::declval<const Range&>().data())>::type;
 
-                i = 0;
-            }
+    class ByteView
+    {
+    public:
+        ByteView() = default;
+
+        ByteView(const void* data, const size_t size)
+            : data_{ static_cast<const char*>(data) }, size_{ size }
+        {
         }
 
-        if (i)  // i == (2 or 3)
+        ByteView(const char* str)
+            : data_{ str }, size_{ (str) ? std::strlen(str) : 0 }
         {
-            memset(encoded_data_4 + i, 0x00, 4 - i);
+        }
 
-            switch (i)
-            {
-            case 3:
-                decoded_data_3[1] = ((encoded_data_4[1] & 0x0F) << 4) |
-                                    ((encoded_data_4[2] & 0x3C) >> 2);
-                FALLTHROUGH;
-            case 2:
-                decoded_data_3[0] = ((encoded_data_4[0] & 0x3F) << 2) |
-                                    ((encoded_data_4[1] & 0x30) >> 4);
-                FALLTHROUGH;
-            default:
-                break;
-            }
+        ByteView(const std::initializer_list<uint8_t>& list)
+            : data_{ reinterpret_cast<const char*>(list.begin()) },
+              size_{ list.size() }
+        {
+        }
 
-            for (int j = 0; j < (i - 1); ++j)
-            {
-                decoded.push_back(decoded_data_3[j]);
-            }
+        template <typename Range, typename = typename std::enable_if<
+            sizeof(range_element_t<Range>) == 1>::type>
+        ByteView(const Range& range)
+            : data_{ reinterpret_cast<const char*>(range.data()) },
+              size_{ static_cast<size_t>(range.size()) }
+        {
         }
 
-        return decoded;
-    }
+        const char* data() const { return data_; }
+        size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+    private:
+        const char* data_ = "";
+        size_t size_ = 0;
+    };
 
 
     /// ========================================================================
-    /// Helper Functions
+    /// Output Containers
+    /// ------------------------------------------------------------------------
+    /// The *_append & try_decode functions, the streaming update() and the
+    /// templated encode<Output>() & decode<Output>() accept any contiguous
+    /// container of 1-byte elements with resize(): std::string,
+    /// std::pmr::string, std::vector<uint8_t> with any allocator, ...
+    /// encode_into() & decode_into() also fill fixed-size ones (std::array).
     /// ========================================================================
 
-    inline std::string encode(StringType str = "")
-    {
-        return (str.empty())
-            ? std::string("")
-            : encode_base(str.data(), str.size());
-    }
-
-    inline std::string encode_urlsafe(StringType str = "")
+    /// Writable storage of `out` from `offset` on; nullptr when `out` ends
+    /// there (nothing will be written).
+    template <typename Output>
+    inline char* output_data(Output& out, const size_t offset)
     {
-        return (str.empty())
-            ? std::string("")
-            : encode_base(str.data(), str.size(), urlsafe_encoding_table);
-    }
+        static_assert(sizeof(out[0]) == 1, "Output must hold 1-byte elements");
 
-    inline std::string encode(const std::initializer_list<uint8_t>& list)
-    {
-        return (list.size() == 0)
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
+        return (out.size() > offset)
+            ? reinterpret_cast<char*>(&out[0]) + offset
+            : nullptr;
     }
 
-    inline std::string encode_urlsafe(
-        const std::initializer_list<uint8_t>& list)
-    {
-        return (list.size() == 0)
-            ? std::string("")
-            : encode_base(reinterpret_cast<const char*>(list.begin()),
-                list.size(), urlsafe_encoding_table);
-    }
 
-    inline std::string encode(const std::vector<uint8_t>& vec)
-    {
-        return (vec.empty())
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
-    }
+    /// ========================================================================
+    /// Compile-time Literals
+    /// ------------------------------------------------------------------------
+    /// The encode_literal() & decode_literal() front ends of each namespace
+    /// are constexpr: every output character or byte is computed straight
+    /// from its position in the input, so a constexpr variable is encoded or
+    /// decoded by the compiler and a malformed literal fails to compile.
+    /// ========================================================================
 
-    inline std::string encode_urlsafe(const std::vector<uint8_t>& vec)
+    /// Decoded bytes of a literal; `Capacity` is an upper bound derived from
+    /// the literal's length and size() the exact count.
+    template <size_t Capacity>
+    struct StaticBytes
     {
-        return (vec.empty())
-            ? std::string("")
-            : encode_base(reinterpret_cast<const char*>(vec.data()),
-                vec.size(), urlsafe_encoding_table);
-    }
+        std::array<uint8_t, Capacity> bytes;
+        size_t length;
 
-    inline std::string decode(StringType str = "")
-    {
-        return (str.empty())
-            ? std::string("")
-            : decode_base(str.data(), str.size());
-    }
+        constexpr size_t size() const { return length; }
+        constexpr bool empty() const { return length == 0; }
+        constexpr uint8_t operator[](const size_t i) const { return bytes[i]; }
 
-    inline std::string decode_urlsafe(StringType str = "")
-    {
-        return (str.empty())
-            ? std::string("")
-            : decode_base(str.data(), str.size(), &urlsafe_decode_char);
-    }
+        const uint8_t* data() const { return bytes.data(); }
+        const uint8_t* begin() const { return bytes.data(); }
+        const uint8_t* end() const { return bytes.data() + length; }
+    };
 
-    inline std::string decode(const std::initializer_list<uint8_t>& list)
+    /// Character `index` of the padded encoding of `src[0, len)`.
+    template <size_t Bits, typename Alphabet, typename Source>
+    constexpr char literal_encoded_char(
+        const Source& src, const size_t len, const size_t index)
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
-    }
+        const size_t bit = index * Bits;
+        if (bit >= len * 8)
+        {
+            return '=';
+        }
 
-    inline std::string decode_urlsafe(
-        const std::initializer_list<uint8_t>& list)
-    {
-        return (list.size() == 0)
-            ? std::string("")
-            : decode_base(reinterpret_cast<const char*>(list.begin()),
-                list.size(), &urlsafe_decode_char);
-    }
+        const size_t byte = bit / 8;
+        const unsigned word =
+            (static_cast<unsigned>(static_cast<uint8_t>(src[byte])) << 8) |
+            ((byte + 1 < len) ? static_cast<uint8_t>(src[byte + 1]) : 0u);
 
-    inline std::string decode(const std::vector<uint8_t>& vec)
-    {
-        return (vec.empty())
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
+        return static_cast<char>(Alphabet::encoding()[
+            (word >> (16 - bit % 8 - Bits)) & ((1u << Bits) - 1)]);
     }
 
-    inline std::string decode_urlsafe(const std::vector<uint8_t>& vec)
+    template <size_t Bits, typename Alphabet, size_t Len, typename Source,
+        size_t... Index>
+    constexpr std::array<char, sizeof...(Index)> encode_static(
+        const Source& src, std::index_sequence<Index...>)
     {
-        return (vec.empty())
-            ? std::string("")
-            : decode_base(reinterpret_cast<const char*>(vec.data()),
-                vec.size(), &urlsafe_decode_char);
+        return { { literal_encoded_char<Bits, Alphabet>(src, Len, Index)... } };
     }
-}  // namespace BaseXX::_64_
-
-namespace _32_
-{
-    /// ========================================================================
-    /// Base32[-Hex] Encoding/Decoding Implementation
-    /// ========================================================================
-
-    /// The Base 32 Alphabet Table
-    /// https://datatracker.ietf.org/doc/html/rfc4648#section-6
-    ///
-    static constexpr uint8_t encoding_table[32] = {
-        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
-        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
-        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
-        'Y', 'Z', '2', '3', '4', '5', '6', '7',  // 24 ~ 31
-    };
-
-    /// The Base 32 Alphabet Table (Extended Hex)
-    /// https://datatracker.ietf.org/doc/html/rfc4648#section-7
-    ///
-    static constexpr uint8_t hex_encoding_table[32] = {
-        '0', '1', '2', '3', '4', '5', '6', '7',  // 0 ~ 7
-        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',  // 8 ~ 15
-        'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N',  // 16 ~ 23
-        'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V',  // 24 ~ 31
-    };
 
-    inline eResultCode check_format(
-        const char* encoded_text, const size_t text_len)
+    /// Number of characters in front of the padding of `text`. Throws (and
+    /// therefore fails constant evaluation) unless `text` is a whole number
+    /// of groups, in the alphabet, with a valid run of trailing padding.
+    template <size_t Bits, size_t CharsPerGroup, typename Alphabet>
+    constexpr size_t literal_data_chars(
+        const char* text, const size_t text_len)
     {
-        if (text_len % 8 != 0)
+        if (text_len % CharsPerGroup != 0)
         {
-            return eResultCode::InvalidLength;
+            throwRuntimeError(eResultCode::InvalidLength, "decode_literal");
         }
 
-        size_t idx = text_len - 1;
-        size_t padding_cnt = 0;
-        while (true)
+        size_t chars = 0;
+        while (chars < text_len && text[chars] != '=')
         {
-            if (padding_cnt > 6)
+            if (Alphabet::decoding()(text[chars]) == invalid_value)
             {
-                return eResultCode::InvalidPaddingCount;
+                throwRuntimeError(
+                    eResultCode::InvalidCharacter, "decode_literal", chars);
             }
-
-            if (encoded_text[idx] != '=')
+            chars++;
+        }
+        for (size_t i = chars; i < text_len; i++)
+        {
+            if (text[i] != '=')
             {
-                break;
+                throwRuntimeError(
+                    eResultCode::InvalidCharacter, "decode_literal", i);
             }
-
-            idx--;
-            padding_cnt++;
         }
 
-        return eResultCode::Success;
-    }
-
-    inline const uint8_t decode_char(const char c)
-    {
-        if (c >= 'A' && c <= 'Z')
-        {
-            return c - 'A';
-        }
-        else if (c >= '2' && c <= '7')
+        // The padding completes the last group, which must hold the fewest
+        // characters for its bytes
+        const size_t tail = chars % CharsPerGroup;
+        if ((text_len - chars) != (CharsPerGroup - tail) % CharsPerGroup ||
+            (tail != 0 && (tail * Bits) / 8 * 8 <= (tail - 1) * Bits))
         {
-            return 26 + (c - '2');
+            throwRuntimeError(
+                eResultCode::InvalidPaddingCount, "decode_literal");
         }
 
-        throwRuntimeError(eResultCode::InvalidCharacter, __FUNCTION__);
+        return chars;
     }
 
-    inline const uint8_t hex_decode_char(const char c)
+    /// Byte `index` of the decoding of `text[0, chars)`; 0 past the end.
+    template <size_t Bits, typename Alphabet>
+    constexpr uint8_t literal_decoded_byte(
+        const char* text, const size_t chars, const size_t index)
     {
-        if (c >= '0' && c <= '9')
+        const size_t bit = index * 8;
+        if (bit + 8 > chars * Bits)
         {
-            return c - '0';
+            return 0;
         }
-        else if (c >= 'A' && c <= 'V')
+
+        const size_t skip = bit % Bits;
+        size_t pos = bit / Bits;
+        unsigned acc = 0;
+        size_t acc_bits = 0;
+        while (acc_bits < skip + 8)
         {
-            return 10 + (c - 'A');
+            acc = (acc << Bits) | Alphabet::decoding()(text[pos++]);
+            acc_bits += Bits;
         }
 
-        throwRuntimeError(eResultCode::InvalidCharacter, __FUNCTION__);
+        return static_cast<uint8_t>(acc >> (acc_bits - skip - 8));
     }
 
-    inline std::string encode_base(const char* data,
-        const size_t data_len, const uint8_t* table = encoding_table)
+    template <size_t Bits, size_t CharsPerGroup, typename Alphabet,
+        size_t... Index>
+    constexpr StaticBytes<sizeof...(Index)> decode_static(
+        const char* text, const size_t text_len,
+        std::index_sequence<Index...>)
     {
-        std::string encoded{};
-        encoded.reserve(data_len * 8 / 5);
-
-        uint8_t decoded_data_5[5] = { 0, };
-        uint8_t encoded_data_8[8] = { 0, };
+        const size_t chars = literal_data_chars<Bits, CharsPerGroup, Alphabet>(
+            text, text_len);
 
-        size_t i = 0;
-        for (size_t pos = 0; pos < data_len; pos++)
-        {
-            decoded_data_5[i++] = data[pos];
-            if (i == 5)
-            {
-                encoded_data_8[0] = (decoded_data_5[0] & 0xF8) >> 3;
+        return StaticBytes<sizeof...(Index)>{
+            { { literal_decoded_byte<Bits, Alphabet>(text, chars, Index)... } },
+            chars * Bits / 8 };
+    }
 
-                encoded_data_8[1] = ((decoded_data_5[0] & 0x07) << 2) |
-                                    ((decoded_data_5[1] & 0xC0) >> 6);
 
-                encoded_data_8[2] = (decoded_data_5[1] & 0x3E) >> 1;
+    /// ========================================================================
+    /// Columnar Batches
+    /// ------------------------------------------------------------------------
+    /// Many short values in one buffer, Arrow-style: row i is
+    /// data[offsets[i], offsets[i + 1]). A batch is encoded or decoded into
+    /// one output buffer and one offsets array, whatever the row count.
+    /// ========================================================================
 
-                encoded_data_8[3] = ((decoded_data_5[1] & 0x01) << 4) |
-                                    ((decoded_data_5[2] & 0xF0) >> 4);
+    struct Column
+    {
+        std::string data{};
+        std::vector<size_t> offsets{ 0 };  // rows() + 1 entries
 
-                encoded_data_8[4] = ((decoded_data_5[2] & 0x0F) << 1) |
-                                    ((decoded_data_5[3] & 0x80) >> 7);
+        size_t rows() const
+        {
+            return offsets.size() - 1;
+        }
 
-                encoded_data_8[5] = (decoded_data_5[3] & 0x7C) >> 2;
+        const char* row_data(const size_t row) const
+        {
+            return data.data() + offsets[row];
+        }
 
-                encoded_data_8[6] = ((decoded_data_5[3] & 0x03) << 3) |
-                                    ((decoded_data_5[4] & 0xE0) >> 5);
+        size_t row_size(const size_t row) const
+        {
+            return offsets[row + 1] - offsets[row];
+        }
 
-                encoded_data_8[7] = decoded_data_5[4] & 0x1F;
+        std::string row(const size_t row) const
+        {
+            return std::string(row_data(row), row_size(row));
+        }
 
-                for (const auto& c : encoded_data_8)
-                {
-                    encoded.push_back(table[c]);
-                }
-                
-                i = 0;
-            }
-        }
-
-        if (i)  // i == (1 ~ 4)
-        {
-            memset(decoded_data_5 + i, 0x00, 5 - i);
-
-            size_t remaining_bytes = 0;
-            switch (i)
-            {
-            case 4:
-                encoded_data_8[6] = (decoded_data_5[3] & 0x03) << 3;
-                encoded_data_8[5] = (decoded_data_5[3] & 0x7C) >> 2;
-                remaining_bytes += 2;
-                FALLTHROUGH;
-            case 3:
-                encoded_data_8[4] = ((decoded_data_5[2] & 0x0F) << 1) |
-                                    ((decoded_data_5[3] & 0x80) >> 7);
-                remaining_bytes++;
-                FALLTHROUGH;
-            case 2:
-                encoded_data_8[3] = ((decoded_data_5[1] & 0x01) << 4) |
-                                    ((decoded_data_5[2] & 0xF0) >> 4);
-                encoded_data_8[2] = (decoded_data_5[1] & 0x3E) >> 1;
-                remaining_bytes += 2;
-                FALLTHROUGH;
-            case 1:
-                encoded_data_8[1] = ((decoded_data_5[0] & 0x07) << 2) |
-                                    ((decoded_data_5[1] & 0xC0) >> 6);
-                encoded_data_8[0] = (decoded_data_5[0] & 0xF8) >> 3;
-                remaining_bytes += 2;
-                FALLTHROUGH;
-            default:
-                break;
-            }
-
-            for (size_t idx = 0; idx < remaining_bytes; idx++)
-            {
-                encoded.push_back(table[encoded_data_8[idx]]);
-            }
+        void push_back(const char* value, const size_t value_len)
+        {
+            data.append(value, value_len);
+            offsets.push_back(data.size());
+        }
 
-            size_t padding_cnt = 8 - (encoded.length() % 8);
-            while (padding_cnt-- != 0)
-            {
-                encoded.push_back('=');
-            }
+        void clear()
+        {
+            data.clear();
+            offsets.assign(1, 0);
         }
+    };
 
-        return encoded;
-    }
+    /// A row of a batch that failed to decode.
+    struct RowError
+    {
+        size_t row = 0;
+        DecodeResult result{};
+    };
 
-    inline std::string decode_base(const char* data,
-        const size_t data_len,
-        const uint8_t (*decode_char_func)(const char) = &decode_char)
+    /// Encode `rows` rows back to back into `dst`; `dst_offsets` receives
+    /// rows + 1 offsets. `encode` is the encode_into() of the codec.
+    template <typename EncodeFunc>
+    inline size_t encode_rows(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, const EncodeFunc& encode)
     {
-        eResultCode code = check_format(data, data_len);
-        if (code != eResultCode::Success)
+        size_t pos = 0;
+        dst_offsets[0] = 0;
+        for (size_t i = 0; i < rows; i++)
         {
-            throwRuntimeError(code, __FUNCTION__);
+            pos += encode(dst + pos, dst_cap - pos,
+                data + offsets[i], offsets[i + 1] - offsets[i]);
+            dst_offsets[i + 1] = pos;
         }
 
-        std::string decoded{};
-        decoded.reserve(data_len * 5 / 8);
-
-        uint8_t encoded_data_8[8] = { 0, };
-        uint8_t decoded_data_5[5] = { 0, };
+        return pos;
+    }
 
-        size_t i = 0;
-        for (size_t pos = 0; pos < data_len; pos++)
+    /// Decode `rows` rows back to back into `dst`; a row that fails is left
+    /// empty. `decode` is the try_decode_into() of the codec and
+    /// `report(row, result)` sees the result of every row. Returns the
+    /// number of failed rows.
+    template <typename DecodeFunc, typename ReportFunc>
+    inline size_t decode_rows(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, const DecodeFunc& decode, const ReportFunc& report)
+    {
+        size_t pos = 0;
+        size_t failed = 0;
+        dst_offsets[0] = 0;
+        for (size_t i = 0; i < rows; i++)
         {
-            if (data[pos] == '=')
+            const DecodeResult result = decode(dst + pos, dst_cap - pos,
+                data + offsets[i], offsets[i + 1] - offsets[i]);
+            if (result)
             {
-                break;
+                pos += result.written;
             }
-
-            encoded_data_8[i++] = decode_char_func(data[pos]);
-
-            if (i == 8)
+            else
             {
-                decoded_data_5[0] = ((encoded_data_8[0] & 0x1F) << 3) |
-                                    ((encoded_data_8[1] & 0x1C) >> 2);
+                failed++;
+            }
+            report(i, result);
+            dst_offsets[i + 1] = pos;
+        }
 
-                decoded_data_5[1] = ((encoded_data_8[1] & 0x03) << 6) |
-                                    ((encoded_data_8[2] & 0x1F) << 1) |
-                                    ((encoded_data_8[3] & 0x10) >> 4);
+        return failed;
+    }
 
-                decoded_data_5[2] = ((encoded_data_8[3] & 0x0F) << 4) |
-                                    ((encoded_data_8[4] & 0x1E) >> 1);
 
-                decoded_data_5[3] = ((encoded_data_8[4] & 0x01) << 7) |
-                                    ((encoded_data_8[5] & 0x1F) << 2) |
-                                    ((encoded_data_8[6] & 0x18) >> 3);
+    /// ========================================================================
+    /// Word Access
+    /// ------------------------------------------------------------------------
+    /// Unaligned loads & stores of 64-bit words for the SWAR kernels.
+    /// memcpy compiles to a single move; big-endian words are byte-swapped.
+    /// ========================================================================
 
-                decoded_data_5[4] = ((encoded_data_8[6] & 0x07) << 5) |
-                                    encoded_data_8[7];
+    inline uint64_t byteswap64(uint64_t word)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_bswap64(word);
+#elif defined(_MSC_VER)
+        return _byteswap_uint64(word);
+#else
+        word = ((word & 0x00FF00FF00FF00FFULL) << 8) |
+               ((word >> 8) & 0x00FF00FF00FF00FFULL);
+        word = ((word & 0x0000FFFF0000FFFFULL) << 16) |
+               ((word >> 16) & 0x0000FFFF0000FFFFULL);
+        return (word << 32) | (word >> 32);
+#endif  // defined(__GNUC__) || defined(__clang__)
+    }
 
-                for(const auto& c : decoded_data_5)
-                {
-                    decoded.push_back(c);
-                }
+    /// First byte in the least significant position.
+    inline uint64_t load_le64(const void* src)
+    {
+        uint64_t word;
+        memcpy(&word, src, sizeof(word));
+#if defined(BASEXX_BIG_ENDIAN)
+        word = byteswap64(word);
+#endif  // defined(BASEXX_BIG_ENDIAN)
 
-                i = 0;
-            }
-        }
+        return word;
+    }
 
-        if (i)  // i == (2 || 4 || 5 || 7)
-        {
-            size_t remaining_bytes = 0;
-            switch (i)
-            {
-            case 7:
-                decoded_data_5[3] = ((encoded_data_8[4] & 0x01) << 7) |
-                                    ((encoded_data_8[5] & 0x1F) << 2) |
-                                    ((encoded_data_8[6] & 0x18) >> 3);
-                remaining_bytes++;
-                FALLTHROUGH;
-            case 5:
-                decoded_data_5[2] = ((encoded_data_8[3] & 0x0F) << 4) |
-                                    ((encoded_data_8[4] & 0x1E) >> 1);
-                remaining_bytes++;
-                FALLTHROUGH;
-            case 4:
-                decoded_data_5[1] = ((encoded_data_8[1] & 0x03) << 6) |
-                                    ((encoded_data_8[2] & 0x1F) << 1) |
-                                    ((encoded_data_8[3] & 0x10) >> 4);
-                remaining_bytes++;
-                FALLTHROUGH;
-            case 2:
-                decoded_data_5[0] = ((encoded_data_8[0] & 0x1F) << 3) |
-                                    ((encoded_data_8[1] & 0x1C) >> 2);
-                remaining_bytes++;
-                FALLTHROUGH;
-            default:
-                break;
-            }
+    /// First byte in the most significant position.
+    inline uint64_t load_be64(const void* src)
+    {
+        return byteswap64(load_le64(src));
+    }
 
-            for (size_t idx = 0; idx < remaining_bytes; idx++)
-            {
-                decoded.push_back(decoded_data_5[idx]);
-            }
-        }
+    inline void store_le64(void* dst, uint64_t word)
+    {
+#if defined(BASEXX_BIG_ENDIAN)
+        word = byteswap64(word);
+#endif  // defined(BASEXX_BIG_ENDIAN)
+        memcpy(dst, &word, sizeof(word));
+    }
 
-        return decoded;
+    /// The low `N` bytes of `word`, most significant first.
+    template <size_t N>
+    inline void store_be(char* dst, const uint64_t word)
+    {
+        uint64_t swapped = byteswap64(word << (8 * (8 - N)));
+#if defined(BASEXX_BIG_ENDIAN)
+        swapped = byteswap64(swapped);
+#endif  // defined(BASEXX_BIG_ENDIAN)
+        memcpy(dst, &swapped, N);
     }
 
 
     /// ========================================================================
-    /// Helper Functions
+    /// Runtime CPU Dispatch
+    /// ------------------------------------------------------------------------
+    /// The CPU is probed once (cpuid/xgetbv) and every codec indexes its
+    /// kernel table with the active eSimdLevel. The level can be forced for
+    /// testing & benchmarking with set_simd_level() or the BASEXX_SIMD_LEVEL
+    /// environment variable (scalar, sse41, avx2, avx512bw); requests above
+    /// what the CPU supports are clamped.
     /// ========================================================================
 
-    inline std::string encode(StringType str = "")
+    enum class eSimdLevel
     {
-        return (str.empty())
-            ? std::string("")
-            : encode_base(str.data(), str.length());
-    }
+        Scalar   = 0,
+        SSE41    = 1,  // SSSE3 + SSE4.1
+        AVX2     = 2,
+        AVX512BW = 3,  // AVX-512 F/BW/VL
+    };
 
-    inline std::string encode_hex(StringType str = "")
+    struct CpuFeatures
     {
-        return (str.empty())
-            ? std::string("")
-            : encode_base(str.data(), str.length(), hex_encoding_table);
-    }
+        bool has_ssse3    = false;
+        bool has_sse41    = false;
+        bool has_avx2     = false;
+        bool has_bmi2     = false;
+        bool has_avx512bw = false;
+    };
 
-    inline std::string encode(const std::initializer_list<uint8_t>& list)
+#if defined(BASEXX_X86_SIMD)
+    inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4])
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
+    #if defined(_MSC_VER)
+        int info[4] = { 0, };
+        __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+        for (size_t i = 0; i < 4; i++)
+        {
+            regs[i] = static_cast<uint32_t>(info[i]);
+        }
+    #else  // defined(_MSC_VER)
+        __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+    #endif  // defined(_MSC_VER)
     }
 
-    inline std::string encode_hex(const std::initializer_list<uint8_t>& list)
+    /// XCR0: which register states the OS saves on context switch.
+    inline uint64_t xgetbv()
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : encode_base(reinterpret_cast<const char*>(list.begin()),
-                list.size(), hex_encoding_table);
+    #if defined(_MSC_VER)
+        return _xgetbv(0);
+    #else  // defined(_MSC_VER)
+        uint32_t eax = 0;
+        uint32_t edx = 0;
+        __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+        return (static_cast<uint64_t>(edx) << 32) | eax;
+    #endif  // defined(_MSC_VER)
     }
+#endif  // defined(BASEXX_X86_SIMD)
 
-    inline std::string encode(const std::vector<uint8_t>& vec)
+    inline CpuFeatures detect_cpu_features()
     {
-        return (vec.empty())
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
+        CpuFeatures features{};
+
+#if defined(BASEXX_X86_SIMD)
+        uint32_t regs[4] = { 0, };  // eax, ebx, ecx, edx
+        cpuid(0, 0, regs);
+        const uint32_t max_leaf = regs[0];
+        if (max_leaf < 1)
+        {
+            return features;
+        }
+
+        cpuid(1, 0, regs);
+        features.has_ssse3 = (regs[2] & (1u << 9)) != 0;
+        features.has_sse41 = (regs[2] & (1u << 19)) != 0;
+
+        const bool has_osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool has_avx     = (regs[2] & (1u << 28)) != 0;
+        const uint64_t xcr0    = has_osxsave ? xgetbv() : 0;
+        const bool ymm_enabled = (xcr0 & 0x06) == 0x06;
+        const bool zmm_enabled = (xcr0 & 0xE6) == 0xE6;
+
+        if (max_leaf < 7)
+        {
+            return features;
+        }
+
+        cpuid(7, 0, regs);
+        features.has_bmi2 = (regs[1] & (1u << 8)) != 0;
+        features.has_avx2 =
+            has_avx && ymm_enabled && (regs[1] & (1u << 5)) != 0;
+        features.has_avx512bw = features.has_avx2 && zmm_enabled &&
+            (regs[1] & (1u << 16)) != 0 &&  // AVX512F
+            (regs[1] & (1u << 30)) != 0 &&  // AVX512BW
+            (regs[1] & (1u << 31)) != 0;    // AVX512VL
+#endif  // defined(BASEXX_X86_SIMD)
+
+        return features;
     }
 
-    inline std::string encode_hex(const std::vector<uint8_t>& vec)
+    inline const CpuFeatures& cpu_features()
     {
-        return (vec.empty())
-            ? std::string("")
-            : encode_base(reinterpret_cast<const char*>(vec.data()),
-                vec.size(), hex_encoding_table);
+        static const CpuFeatures features{ detect_cpu_features() };
+        return features;
     }
 
-    inline std::string decode(StringType str = "")
+    /// The highest level this CPU (and build) can run.
+    inline eSimdLevel max_simd_level()
     {
-        return (str.empty())
-            ? std::string("")
-            : decode_base(str.data(), str.size());
+        const CpuFeatures& features = cpu_features();
+        if (features.has_avx512bw && features.has_bmi2)
+        {
+            return eSimdLevel::AVX512BW;
+        }
+        else if (features.has_avx2 && features.has_bmi2)
+        {
+            return eSimdLevel::AVX2;
+        }
+        else if (features.has_ssse3 && features.has_sse41)
+        {
+            return eSimdLevel::SSE41;
+        }
+
+        return eSimdLevel::Scalar;
     }
 
-    inline std::string decode_hex(StringType str = "")
+    inline const char* simd_level_name(eSimdLevel level)
     {
-        return (str.empty())
-            ? std::string("")
-            : decode_base(str.data(), str.size(), &hex_decode_char);
+        switch (level)
+        {
+        case eSimdLevel::SSE41:
+            return "sse41";
+        case eSimdLevel::AVX2:
+            return "avx2";
+        case eSimdLevel::AVX512BW:
+            return "avx512bw";
+        default:
+            return "scalar";
+        }
     }
 
-    inline std::string decode(const std::initializer_list<uint8_t>& list)
+    /// Initial level: BASEXX_SIMD_LEVEL if set & supported, else the maximum.
+    inline eSimdLevel default_simd_level()
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
+        const eSimdLevel max_level = max_simd_level();
+
+#if defined(_MSC_VER)
+        char* value = nullptr;
+        size_t value_len = 0;
+        if (_dupenv_s(&value, &value_len, "BASEXX_SIMD_LEVEL") != 0 ||
+            value == nullptr)
+        {
+            return max_level;
+        }
+        const std::string name{ value };
+        free(value);
+#else  // defined(_MSC_VER)
+        const char* value = std::getenv("BASEXX_SIMD_LEVEL");
+        if (value == nullptr)
+        {
+            return max_level;
+        }
+        const std::string name{ value };
+#endif  // defined(_MSC_VER)
+
+        for (const eSimdLevel level : { eSimdLevel::Scalar, eSimdLevel::SSE41,
+            eSimdLevel::AVX2, eSimdLevel::AVX512BW })
+        {
+            if (name == simd_level_name(level))
+            {
+                return (level < max_level) ? level : max_level;
+            }
+        }
+
+        return max_level;
     }
 
-    inline std::string decode_hex(const std::initializer_list<uint8_t>& list)
+    inline std::atomic<eSimdLevel>& active_simd_level()
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : decode_base(reinterpret_cast<const char*>(list.begin()),
-                list.size(), &hex_decode_char);
+        static std::atomic<eSimdLevel> level{ default_simd_level() };
+        return level;
     }
 
-    inline std::string decode(const std::vector<uint8_t>& vec)
+    inline eSimdLevel simd_level()
     {
-        return (vec.empty())
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
+        return active_simd_level().load(std::memory_order_relaxed);
     }
 
-    inline std::string decode_hex(const std::vector<uint8_t>& vec)
+    /// Force the kernels used by every codec. Returns the level actually set,
+    /// which is clamped to max_simd_level().
+    inline eSimdLevel set_simd_level(eSimdLevel level)
     {
-        return (vec.empty())
-            ? std::string("")
-            : decode_base(reinterpret_cast<const char*>(vec.data()),
-                vec.size(), &hex_decode_char);
+        const eSimdLevel max_level = max_simd_level();
+        if (level > max_level)
+        {
+            level = max_level;
+        }
+        active_simd_level().store(level, std::memory_order_relaxed);
+
+        return level;
     }
-}  // namespace BaseXX::_32_
 
-namespace _16_
-{
+
     /// ========================================================================
-    /// Base16 Encoding/Decoding Implementation
+    /// Whitespace
+    /// ------------------------------------------------------------------------
+    /// ASCII whitespace as the WHATWG Infra standard defines it: TAB, LF, FF,
+    /// CR and SPACE. compact_spaces() copies text without it a vector at a
+    /// time: vectors free of whitespace are stored as they are, the others
+    /// are packed 8 bytes at a time with pshufb.
     /// ========================================================================
 
-    /// The Base 16 Alphabet Table
-    /// https://datatracker.ietf.org/doc/html/rfc4648#section-8
-    ///
-    static constexpr uint8_t encoding_table[16] = {
-        '0', '1', '2', '3', '4', '5', '6', '7',  // 0 ~ 7
-        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',  // 8 ~ 15
+    /// Input accepted by the whitespace-tolerant decoders.
+    enum class eLenience
+    {
+        Whitespace = 1,  // whitespace anywhere, padding as in RFC 4648
+        Forgiving  = 2,  // also optional padding (WHATWG forgiving-base64)
     };
 
-    inline const uint8_t decode_char(const char c)
+    constexpr bool is_space(const char c)
     {
-        if (c >= '0' && c <= '9')
+        return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r';
+    }
+
+    /// Copy `src` to `dst` without whitespace; returns the number of bytes
+    /// kept. `dst` must have room for `len` bytes.
+    inline size_t compact_spaces_scalar(
+        char* dst, const char* src, const size_t len)
+    {
+        char* const dst_begin = dst;
+
+        size_t pos = 0;
+        for (; pos + 8 <= len; pos += 8)
+        {
+            // No byte under 0x21, so none is whitespace
+            const uint64_t word = load_le64(src + pos);
+            if (((word - 0x2121212121212121ull) & ~word &
+                 0x8080808080808080ull) == 0)
+            {
+                memcpy(dst, src + pos, 8);
+                dst += 8;
+                continue;
+            }
+
+            for (size_t i = pos; i < pos + 8; i++)
+            {
+                *dst = src[i];
+                dst += !is_space(src[i]);
+            }
+        }
+        for (; pos < len; pos++)
         {
-            return c - '0';
+            *dst = src[pos];
+            dst += !is_space(src[pos]);
         }
-        else if (c >= 'A' && c <= 'F')
+
+        return dst - dst_begin;
+    }
+
+#if defined(BASEXX_X86_SIMD)
+    /// pshufb indices packing the bytes of an 8-byte lane that are not set in
+    /// the index mask, and how many bytes that keeps.
+    struct CompactLut
+    {
+        uint64_t shuffle[256];
+        uint8_t kept[256];
+    };
+
+    constexpr CompactLut make_compact_lut()
+    {
+        CompactLut lut{};
+        for (size_t mask = 0; mask < 256; mask++)
         {
-            return 10 + (c - 'A');
+            size_t kept = 0;
+            for (size_t i = 0; i < 8; i++)
+            {
+                if ((mask & (size_t{ 1 } << i)) == 0)
+                {
+                    lut.shuffle[mask] |= static_cast<uint64_t>(i) << (8 * kept);
+                    kept++;
+                }
+            }
+            lut.kept[mask] = static_cast<uint8_t>(kept);
         }
 
-        throwRuntimeError(eResultCode::InvalidCharacter, __FUNCTION__);
+        return lut;
     }
 
-    inline std::string encode_base(const char* data,
-        const size_t data_len, const uint8_t* table = encoding_table)
+    static constexpr CompactLut compact_lut = make_compact_lut();
+
+    /// 0xFF in every whitespace byte: each of them equals the entry of its
+    /// low nibble, and bytes >= 0x80 shuffle to 0.
+    BASEXX_TARGET_SSE41
+    inline __m128i space_lut_ssse3()
     {
-        std::string encoded{};
-        encoded.reserve(data_len * 2);
+        return _mm_setr_epi8(
+            ' ', 0, 0, 0, 0, 0, 0, 0, 0, '\t', '\n', 0, '\f', '\r', 0, 0);
+    }
+
+    /// Store the bytes of `in` not set in `mask` at `dst`; 16 bytes are
+    /// written. Returns the end of the kept bytes.
+    BASEXX_TARGET_SSE41
+    inline char* compact_16_ssse3(char* dst, const __m128i in,
+        const unsigned mask)
+    {
+        const unsigned lo = mask & 0xFF;
+        const unsigned hi = mask >> 8;
+        const __m128i shuffle = _mm_add_epi8(
+            _mm_set_epi64x(static_cast<long long>(compact_lut.shuffle[hi]),
+                static_cast<long long>(compact_lut.shuffle[lo])),
+            _mm_set_epi64x(0x0808080808080808ll, 0));
+        const __m128i packed = _mm_shuffle_epi8(in, shuffle);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+        dst += compact_lut.kept[lo];
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+            _mm_unpackhi_epi64(packed, packed));
+
+        return dst + compact_lut.kept[hi];
+    }
 
-        uint8_t encoded_data_2[2] = { 0, };
+    BASEXX_TARGET_SSE41
+    inline size_t compact_spaces_ssse3(
+        char* dst, const char* src, const size_t len)
+    {
+        const __m128i lut = space_lut_ssse3();
+        char* const dst_begin = dst;
 
-        for (size_t pos = 0; pos < data_len; pos++)
+        size_t pos = 0;
+        for (; pos + 16 <= len; pos += 16)
         {
-            encoded_data_2[0] = (data[pos] & 0xF0) >> 4;
-            encoded_data_2[1] = data[pos] & 0x0F;
+            const __m128i in =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos));
+            const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_shuffle_epi8(lut, in), in)));
+            if (mask == 0)
+            {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), in);
+                dst += 16;
+                continue;
+            }
+
+            dst = compact_16_ssse3(dst, in, mask);
+        }
+
+        return (dst - dst_begin) +
+            compact_spaces_scalar(dst, src + pos, len - pos);
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t compact_spaces_avx2(
+        char* dst, const char* src, const size_t len)
+    {
+        const __m256i lut = _mm256_broadcastsi128_si256(space_lut_ssse3());
+        char* const dst_begin = dst;
 
-            for (const auto& c : encoded_data_2)
+        size_t pos = 0;
+        for (; pos + 32 <= len; pos += 32)
+        {
+            const __m256i in =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + pos));
+            const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_shuffle_epi8(lut, in), in)));
+            if (mask == 0)
             {
-                encoded.push_back(table[c]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), in);
+                dst += 32;
+                continue;
             }
+
+            dst = compact_16_ssse3(
+                dst, _mm256_castsi256_si128(in), mask & 0xFFFF);
+            dst = compact_16_ssse3(
+                dst, _mm256_extracti128_si256(in, 1), mask >> 16);
         }
 
-        return encoded;
+        return (dst - dst_begin) +
+            compact_spaces_ssse3(dst, src + pos, len - pos);
     }
+#endif  // defined(BASEXX_X86_SIMD)
 
-    inline std::string decode_base(const char* data, const size_t data_len)
+    /// compact_spaces_*() of the active SIMD level.
+    inline size_t compact_spaces(char* dst, const char* src, const size_t len)
     {
-        if (data_len % 2 != 0)
+#if defined(BASEXX_X86_SIMD)
+        switch (simd_level())
         {
-            throwRuntimeError(eResultCode::InvalidLength, __FUNCTION__);
+        case eSimdLevel::AVX2:
+        case eSimdLevel::AVX512BW:
+            return compact_spaces_avx2(dst, src, len);
+        case eSimdLevel::SSE41:
+            return compact_spaces_ssse3(dst, src, len);
+        default:
+            break;
         }
+#endif  // defined(BASEXX_X86_SIMD)
 
-        std::string decoded{};
-        decoded.reserve(data_len / 2);
+        return compact_spaces_scalar(dst, src, len);
+    }
+
+    /// Offset in `data` of its `index`-th character that is not whitespace.
+    inline size_t spaced_offset(const char* data, size_t index)
+    {
+        size_t pos = 0;
+        for (;; pos++)
+        {
+            if (!is_space(data[pos]) && index-- == 0)
+            {
+                return pos;
+            }
+        }
+    }
 
-        for (size_t i = 0; i < data_len; i += 2)
+    /// Decode `data` ignoring whitespace. `decode(dst, cap, text, len)` is
+    /// the strict decoder of the codec. The text is compacted a block at a
+    /// time into an L1-sized buffer and every block's whole groups go to
+    /// `decode`; the partial group left over is carried into the next block.
+    /// Padding must close the text; with eLenience::Forgiving it may also
+    /// be left out.
+    template <size_t CharsPerGroup, size_t BytesPerGroup, typename Decode>
+    inline DecodeResult decode_spaced(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const eLenience lenience,
+        const Decode& decode)
+    {
+        // Trailing padding, whitespace allowed in between
+        size_t end = data_len;
+        size_t padding = 0;
+        while (end > 0 && (is_space(data[end - 1]) || data[end - 1] == '='))
         {
-            decoded += ((decode_char(data[i]) & 0x0F) << 4) |
-                       decode_char(data[i + 1]);
+            padding += (data[end - 1] == '=') ? 1 : 0;
+            end--;
         }
 
-        return decoded;
+        // Text in front of the first whitespace is decoded in place: the
+        // strict decoder stops there with the groups before it written.
+        const size_t fits = dst_cap / BytesPerGroup * CharsPerGroup;
+        size_t clean = ((end < fits) ? end : fits) / CharsPerGroup *
+            CharsPerGroup;
+        DecodeResult result = decode(dst, dst_cap, data, clean);
+        if (result.code == eResultCode::InvalidCharacter &&
+            is_space(data[result.offset]))
+        {
+            clean = result.written / BytesPerGroup * CharsPerGroup;
+            result = DecodeResult{ eResultCode::Success, 0, result.written };
+        }
+        else if (result &&
+            result.written != clean / CharsPerGroup * BytesPerGroup)
+        {
+            // '=' in the middle stops the strict decoder short
+            result.code = eResultCode::InvalidCharacter;
+            result.offset = static_cast<size_t>(
+                static_cast<const char*>(memchr(data, '=', clean)) - data);
+        }
+        if (!result)
+        {
+            return result;
+        }
+
+        constexpr size_t block_cap = 4096;
+        char block[block_cap + CharsPerGroup];
+        size_t carry = 0;        // partial group at the front of `block`
+        size_t decoded = clean;  // characters decoded before `block`
+        size_t written = result.written;
+
+        for (size_t pos = clean; pos < end; )
+        {
+            const size_t take =
+                (end - pos < block_cap) ? end - pos : block_cap;
+            const size_t total =
+                carry + compact_spaces(block + carry, data + pos, take);
+            const size_t whole = total / CharsPerGroup * CharsPerGroup;
+            pos += take;
+
+            result = decode(dst + written, dst_cap - written, block, whole);
+            if (result &&
+                result.written != whole / CharsPerGroup * BytesPerGroup)
+            {
+                // '=' in the middle stops the strict decoder short
+                result.code = eResultCode::InvalidCharacter;
+                result.offset = static_cast<size_t>(
+                    static_cast<const char*>(memchr(block, '=', whole)) -
+                    block);
+            }
+            if (!result)
+            {
+                result.written += written;
+                if (result.code == eResultCode::InvalidCharacter)
+                {
+                    result.offset =
+                        spaced_offset(data, decoded + result.offset);
+                }
+
+                return result;
+            }
+
+            written += result.written;
+            decoded += whole;
+            carry = total - whole;
+            memmove(block, block + whole, carry);
+        }
+
+        // The last partial group, completed with its padding
+        if (carry == 0 && padding == 0)
+        {
+            return DecodeResult{ eResultCode::Success, 0, written };
+        }
+
+        const size_t missing = (carry == 0) ? 0 : CharsPerGroup - carry;
+        const bool padded = (padding == missing) ||
+            (padding == 0 && lenience == eLenience::Forgiving);
+        if (carry != 0 && padded)
+        {
+            memset(block + carry, '=', missing);
+            result =
+                decode(dst + written, dst_cap - written, block, CharsPerGroup);
+            result.written += written;
+            if (result || (result.code == eResultCode::InvalidCharacter &&
+                           result.offset < carry))
+            {
+                if (!result)
+                {
+                    result.offset =
+                        spaced_offset(data, decoded + result.offset);
+                }
+
+                return result;
+            }
+            if (result.code == eResultCode::InvalidBufferSize)
+            {
+                return result;
+            }
+        }
+
+        return DecodeResult{ (padding == 0)
+            ? eResultCode::InvalidLength : eResultCode::InvalidPaddingCount,
+            end, written };
     }
 
 
     /// ========================================================================
-    /// Helper Functions
+    /// Codec Engine
+    /// ------------------------------------------------------------------------
+    /// Format rules & scalar loops written once for any number of bits per
+    /// character. The group geometry is derived at compile time: a group is
+    /// the fewest characters holding whole bytes (6 bits: 4 characters for 3
+    /// bytes, 5 bits: 8 for 5, 4 bits: 2 for 1). Bulk input goes through the
+    /// SIMD plug-in of the alphabet policy, the scalar loops finish the rest.
+    /// Codec<Alphabet, BitsPerChar, Padding> binds it all to one alphabet;
+    /// the encode & decode functions of _64_, _32_ & _16_ wrap it.
     /// ========================================================================
 
-    inline std::string encode(StringType str)
+    template <size_t BitsPerChar>
+    struct Geometry
     {
-        return (str.empty())
-            ? std::string("")
-            : encode_base(str.data(), str.size());
-    }
+        static_assert(BitsPerChar >= 1 && BitsPerChar <= 7,
+            "A character carries 1 to 7 bits.");
+
+        /// lcm(8, BitsPerChar)
+        static constexpr size_t bits_per_group =
+            8 * BitsPerChar / (BitsPerChar & (0 - BitsPerChar));
+        static constexpr size_t chars_per_group = bits_per_group / BitsPerChar;
+        static constexpr size_t bytes_per_group = bits_per_group / 8;
+
+        /// Padding after the shortest last group (0: no padding, as Base16)
+        static constexpr size_t max_padding =
+            chars_per_group - (8 + BitsPerChar - 1) / BitsPerChar;
+
+        /// Whether a last group of `rest` characters is the shortest one for
+        /// its bytes, e.g. 2, 4, 5 or 7 characters in Base32.
+        static constexpr bool valid_rest(const size_t rest)
+        {
+            return rest == 0 ||
+                rest * BitsPerChar / 8 > (rest - 1) * BitsPerChar / 8;
+        }
 
-    inline std::string encode(const std::initializer_list<uint8_t>& list)
-    {
-        return (list.size() == 0)
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
-    }
+        /// Length of the encoding of `data_len` bytes.
+        static constexpr size_t encoded_length(
+            const size_t data_len, const ePadding padding)
+        {
+            return (padding == ePadding::Required || max_padding == 0)
+                ? (data_len + bytes_per_group - 1) / bytes_per_group *
+                    chars_per_group
+                : data_len / bytes_per_group * chars_per_group +
+                    (data_len % bytes_per_group * 8 + BitsPerChar - 1) /
+                    BitsPerChar;
+        }
 
-    inline std::string encode(const std::vector<uint8_t>& vec)
-    {
-        return (vec.empty())
-            ? std::string("")
-            : encode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
-    }
+        /// Exact decoded length of an encoded text. Only the trailing padding
+        /// is inspected; the characters themselves are not validated.
+        static constexpr size_t decoded_length(
+            const char* encoded_text, const size_t text_len)
+        {
+            size_t chars = text_len;
+            while (chars > 0 && text_len - chars < max_padding &&
+                   encoded_text[chars - 1] == '=')
+            {
+                chars--;
+            }
 
-    inline std::string decode(StringType str)
-    {
-        return (str.empty())
-            ? std::string("")
-            : decode_base(str.data(), str.size());
-    }
+            return chars / chars_per_group * bytes_per_group +
+                chars % chars_per_group * BitsPerChar / 8;
+        }
+
+        /// Length & padding checks of a text to decode. Without padding the
+        /// last group may be short, as long as valid_rest() holds for it;
+        /// padding must complete such a group.
+        static eResultCode check_format(const char* encoded_text,
+            const size_t text_len, const ePadding padding)
+        {
+            const size_t rest = text_len % chars_per_group;
+            if (rest != 0)
+            {
+                const bool unpadded = max_padding != 0 && valid_rest(rest) &&
+                    encoded_text[text_len - 1] != '=';
+                return (padding != ePadding::Required && unpadded)
+                    ? eResultCode::Success : eResultCode::InvalidLength;
+            }
+            if (max_padding == 0 || text_len == 0)
+            {
+                return eResultCode::Success;
+            }
+
+            size_t padding_cnt = 0;
+            while (padding_cnt < text_len &&
+                   encoded_text[text_len - 1 - padding_cnt] == '=')
+            {
+                if (++padding_cnt > max_padding)
+                {
+                    return eResultCode::InvalidPaddingCount;
+                }
+            }
+
+            return (!valid_rest((text_len - padding_cnt) % chars_per_group) ||
+                    (padding == ePadding::None && padding_cnt != 0))
+                ? eResultCode::InvalidPaddingCount : eResultCode::Success;
+        }
+    };
 
-    inline std::string decode(const std::initializer_list<uint8_t>& list)
+    template <size_t BitsPerChar>
+    constexpr size_t Geometry<BitsPerChar>::bits_per_group;
+    template <size_t BitsPerChar>
+    constexpr size_t Geometry<BitsPerChar>::chars_per_group;
+    template <size_t BitsPerChar>
+    constexpr size_t Geometry<BitsPerChar>::bytes_per_group;
+    template <size_t BitsPerChar>
+    constexpr size_t Geometry<BitsPerChar>::max_padding;
+
+    /// SIMD plug-in of the alphabet policies without kernels: the scalar
+    /// loops take everything. Policies with kernels provide the same three
+    /// functions, each returning how much of its input it has done.
+    struct ScalarPlugin
     {
-        return (list.size() == 0)
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(list.begin()), list.size());
-    }
+        static size_t encode_bulk(const uint8_t*, const size_t, char*)
+        {
+            return 0;
+        }
+
+        static size_t decode_bulk(const char*, const size_t, char*)
+        {
+            return 0;
+        }
+
+        static size_t validate_bulk(const char*, const size_t)
+        {
+            return 0;
+        }
+    };
 
-    inline std::string decode(const std::vector<uint8_t>& vec)
+    /// Encode into caller memory; returns the number of characters written.
+    /// `bulk(src, len, dst)` encodes leading whole groups first and returns
+    /// the number of bytes it consumed.
+    template <size_t BitsPerChar, typename Bulk>
+    inline size_t encode_groups(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const uint8_t* table,
+        const ePadding padding, const Bulk& bulk)
     {
-        return (vec.empty())
-            ? std::string("")
-            : decode_base(
-                reinterpret_cast<const char*>(vec.data()), vec.size());
-    }
-}  // namespace BaseXX::_16_
+        using G = Geometry<BitsPerChar>;
+        constexpr uint64_t mask = (1u << BitsPerChar) - 1;
+
+        const size_t encoded_len = G::encoded_length(data_len, padding);
+        if (dst_cap < encoded_len)
+        {
+            throwRuntimeError(eResultCode::InvalidBufferSize, "encode_into");
+        }
+
+        const uint8_t* const src = reinterpret_cast<const uint8_t*>(data);
+        const size_t whole = data_len / G::bytes_per_group * G::bytes_per_group;
+        size_t pos = bulk(src, data_len, dst);
+        dst += pos / G::bytes_per_group * G::chars_per_group;
+
+        for (; pos < whole; pos += G::bytes_per_group)
+        {
+            uint64_t bits = 0;
+            for (size_t j = 0; j < G::bytes_per_group; j++)
+            {
+                bits = (bits << 8) | src[pos + j];
+            }
+            for (size_t j = G::chars_per_group; j-- != 0; )
+            {
+                *dst++ = table[(bits >> (j * BitsPerChar)) & mask];
+            }
+        }
+
+        const size_t rest = data_len - pos;
+        if (rest != 0)
+        {
+            // The last bytes, zero-filled to whole characters
+            const size_t chars = (rest * 8 + BitsPerChar - 1) / BitsPerChar;
+            uint64_t bits = 0;
+            for (size_t j = 0; j < rest; j++)
+            {
+                bits = (bits << 8) | src[pos + j];
+            }
+            bits <<= chars * BitsPerChar - rest * 8;
+
+            for (size_t j = chars; j-- != 0; )
+            {
+                *dst++ = table[(bits >> (j * BitsPerChar)) & mask];
+            }
+
+            size_t padding_cnt = (padding == ePadding::Required)
+                ? G::chars_per_group - chars : 0;
+            while (padding_cnt-- != 0)
+            {
+                *dst++ = '=';
+            }
+        }
+
+        return encoded_len;
+    }
+
+    /// Decode loop shared by every alphabet. `value` maps a character to its
+    /// value or invalid_value: the DecodeTable of an alphabet policy, or a
+    /// caller-supplied function. `bulk(src, len, dst)` decodes leading whole
+    /// groups first and returns the number of characters it consumed. It
+    /// stores nothing for the characters past that count, and no group is
+    /// stored before its characters are read, so `dst` may trail `data` in
+    /// the same buffer (decode_inplace()).
+    template <size_t BitsPerChar, typename ValueFunc, typename Bulk>
+    inline DecodeResult decode_groups(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const ValueFunc& value,
+        const ePadding padding, const Bulk& bulk)
+    {
+        using G = Geometry<BitsPerChar>;
+
+        if (data_len == 0)
+        {
+            return DecodeResult{};
+        }
+
+        const eResultCode code = G::check_format(data, data_len, padding);
+        if (code != eResultCode::Success)
+        {
+            return format_error(code, data, data_len, G::chars_per_group);
+        }
+
+        if (dst_cap < G::decoded_length(data, data_len))
+        {
+            return DecodeResult{ eResultCode::InvalidBufferSize, 0, 0 };
+        }
+
+        char* const dst_begin = dst;
+
+        // The last group, padded or short, is left to the scalar loops.
+        // Without padding (Base16) every group is whole and none is.
+        const size_t whole = (G::max_padding == 0)
+            ? data_len / G::chars_per_group * G::chars_per_group
+            : (data_len - 1) / G::chars_per_group * G::chars_per_group;
+        size_t pos = bulk(data, whole, dst);
+        dst += pos / G::chars_per_group * G::bytes_per_group;
+
+        // Whole groups: one table load per character and a single check.
+        // '=' and invalid characters drop to the per-character loop below.
+        for (; pos < whole; pos += G::chars_per_group)
+        {
+            uint64_t bits = 0;
+            uint32_t invalid = 0;
+            for (size_t j = 0; j < G::chars_per_group; j++)
+            {
+                const uint8_t v = value(data[pos + j]);
+                invalid |= v;
+                bits = (bits << BitsPerChar) | v;
+            }
+            if (invalid & 0x80)
+            {
+                break;
+            }
+
+            store_be<G::bytes_per_group>(dst, bits);
+            dst += G::bytes_per_group;
+        }
+
+        uint64_t bits = 0;
+        size_t chars = 0;
+        for (; pos < data_len; pos++)
+        {
+            if (G::max_padding != 0 && data[pos] == '=')
+            {
+                break;
+            }
+
+            const uint8_t v = value(data[pos]);
+            if (v == invalid_value)
+            {
+                return DecodeResult{ eResultCode::InvalidCharacter,
+                    pos, static_cast<size_t>(dst - dst_begin) };
+            }
+            bits = (bits << BitsPerChar) | v;
+
+            if (++chars == G::chars_per_group)
+            {
+                store_be<G::bytes_per_group>(dst, bits);
+                dst += G::bytes_per_group;
+                bits = 0;
+                chars = 0;
+            }
+        }
+
+        // Only more padding may follow the first '=', which is otherwise
+        // invalid where it stands, as validate_groups() reports it.
+        for (size_t j = pos; j < data_len; j++)
+        {
+            if (data[j] != '=')
+            {
+                return DecodeResult{ eResultCode::InvalidCharacter,
+                    pos, static_cast<size_t>(dst - dst_begin) };
+            }
+        }
+
+        // A short last group: its whole bytes, the leftover bits dropped
+        const size_t bit_count = chars * BitsPerChar;
+        for (size_t j = 8; j <= bit_count; j += 8)
+        {
+            *dst++ = static_cast<char>(bits >> (bit_count - j));
+        }
+
+        return DecodeResult{ eResultCode::Success,
+            0, static_cast<size_t>(dst - dst_begin) };
+    }
+
+    /// The checks of decode_groups() without writing anything. `bulk(src,
+    /// len)` classifies leading characters first and returns the number of
+    /// valid ones.
+    template <size_t BitsPerChar, typename ValueFunc, typename Bulk>
+    inline DecodeResult validate_groups(const char* data,
+        const size_t data_len, const ValueFunc& value,
+        const ePadding padding, const Bulk& bulk)
+    {
+        using G = Geometry<BitsPerChar>;
+
+        if (data_len == 0)
+        {
+            return DecodeResult{};
+        }
+
+        const eResultCode code = G::check_format(data, data_len, padding);
+        if (code != eResultCode::Success)
+        {
+            return format_error(code, data, data_len, G::chars_per_group);
+        }
+
+        size_t chars = data_len;  // in front of the padding
+        while (G::max_padding != 0 && data[chars - 1] == '=')
+        {
+            chars--;
+        }
+
+        for (size_t pos = bulk(data, chars); pos < chars; pos++)
+        {
+            if (value(data[pos]) == invalid_value)
+            {
+                return DecodeResult{ eResultCode::InvalidCharacter, pos,
+                    pos / G::chars_per_group * G::bytes_per_group };
+            }
+        }
+
+        return DecodeResult{ eResultCode::Success,
+            0, G::decoded_length(data, data_len) };
+    }
+
+    /// Value of `c` through `value`; throws outside the alphabet. The body
+    /// of the *decode_char() lookups.
+    template <typename ValueFunc>
+    inline uint8_t decode_value_or_throw(
+        const ValueFunc& value, const char c, StringType caller_info)
+    {
+        const uint8_t v = value(c);
+        if (v == invalid_value)
+        {
+            throwRuntimeError(eResultCode::InvalidCharacter, caller_info);
+        }
+
+        return v;
+    }
+
+    /// Alphabet policy chosen at run time, behind the overloads of _64_, _32_
+    /// & _16_ taking an encoding table or a character lookup (see their
+    /// runtime_alphabet()). It fills one side: encoding through `table` and
+    /// the bulk encoder of the codec, which takes any table, or decoding
+    /// through `values` (`value_func` without them) and the kernels of a
+    /// built-in policy, or the scalar loops alone for a caller's lookup.
+    struct RuntimeAlphabet
+    {
+        using EncodeWords = size_t (*)(const uint8_t* src,
+            const size_t src_len, char* dst, const uint8_t* table);
+        using DecodeWords = size_t (*)(
+            const char* src, const size_t src_len, char* dst);
+        using ValidateWords = size_t (*)(
+            const char* src, const size_t src_len);
+
+        const uint8_t* table;
+        EncodeWords encode_words;
+        const DecodeTable* values;
+        uint8_t (*value_func)(const char);
+        DecodeWords decode_words;
+        ValidateWords validate_words;
+
+        /// Encoding through `table`; `words(src, len, dst, table)` is the
+        /// bulk encoder of the codec, e.g. _64_::encode_words().
+        static RuntimeAlphabet encoder(
+            const uint8_t* table, const EncodeWords words)
+        {
+            return RuntimeAlphabet{
+                table, words, nullptr, nullptr, nullptr, nullptr };
+        }
+
+        /// Decoding through the tables & kernels of the policy `Alphabet`.
+        template <typename Alphabet>
+        static RuntimeAlphabet decoder()
+        {
+            return RuntimeAlphabet{ nullptr, nullptr, &Alphabet::decoding(),
+                nullptr, &Alphabet::decode_bulk, &Alphabet::validate_bulk };
+        }
+
+        /// Decoding through a caller-supplied lookup, in the scalar loops.
+        static RuntimeAlphabet decoder(uint8_t (*value_func)(const char))
+        {
+            return RuntimeAlphabet{ nullptr, nullptr, nullptr, value_func,
+                &ScalarPlugin::decode_bulk, &ScalarPlugin::validate_bulk };
+        }
+
+        const uint8_t* encoding() const
+        {
+            return table;
+        }
+
+        const RuntimeAlphabet& decoding() const
+        {
+            return *this;
+        }
+
+        uint8_t operator()(const char c) const
+        {
+            return (values != nullptr) ? (*values)(c) : value_func(c);
+        }
+
+        size_t encode_bulk(
+            const uint8_t* src, const size_t src_len, char* dst) const
+        {
+            return encode_words(src, src_len, dst, table);
+        }
+
+        size_t decode_bulk(
+            const char* src, const size_t src_len, char* dst) const
+        {
+            return decode_words(src, src_len, dst);
+        }
+
+        size_t validate_bulk(const char* src, const size_t src_len) const
+        {
+            return validate_words(src, src_len);
+        }
+    };
+
+    /// Encoder & decoder of one alphabet. `Alphabet` provides encoding(),
+    /// the table of its 2^BitsPerChar characters, decoding(), their reverse
+    /// lookup, and the encode_bulk(), decode_bulk() & validate_bulk()
+    /// plug-in of its SIMD kernels (see ScalarPlugin). Every function takes
+    /// the policy object last: the static policies default it, only a
+    /// RuntimeAlphabet has to be passed. `Padding` is the default of every
+    /// call and the padding of the parallel, batch & streaming functions,
+    /// e.g. ePadding::None for JWT segments:
+    ///
+    ///     using Jwt = BaseXX::Codec<
+    ///         base64::UrlSafeAlphabet, 6, BaseXX::ePadding::None>;
+    ///     std::string segment = Jwt::encode(json.data(), json.size());
+    template <typename Alphabet, size_t BitsPerChar,
+        ePadding Padding = ePadding::Required>
+    struct Codec : Geometry<BitsPerChar>
+    {
+        using geometry = Geometry<BitsPerChar>;
+
+        static constexpr size_t encoded_length(
+            const size_t data_len, const ePadding padding = Padding)
+        {
+            return geometry::encoded_length(data_len, padding);
+        }
+
+        static eResultCode check_format(const char* encoded_text,
+            const size_t text_len, const ePadding padding = Padding)
+        {
+            return geometry::check_format(encoded_text, text_len, padding);
+        }
+
+        /// Encode into caller memory; returns the number of characters
+        /// written.
+        static size_t encode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return encode_groups<BitsPerChar>(dst, dst_cap, data, data_len,
+                alphabet.encoding(), padding,
+                [&alphabet](const uint8_t* src, const size_t src_len,
+                    char* out)
+                {
+                    return alphabet.encode_bulk(src, src_len, out);
+                });
+        }
+
+        /// Decode into caller memory without throwing. On failure the result
+        /// holds the offset of the first offending character and the number
+        /// of bytes decoded in front of it.
+        static DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return decode_groups<BitsPerChar>(dst, dst_cap, data, data_len,
+                alphabet.decoding(), padding,
+                [&alphabet](const char* src, const size_t src_len, char* out)
+                {
+                    return alphabet.decode_bulk(src, src_len, out);
+                });
+        }
+
+        /// Decode into caller memory; returns the number of bytes written.
+        static size_t decode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const DecodeResult result = try_decode_into(
+                dst, dst_cap, data, data_len, padding, alphabet);
+            if (!result)
+            {
+                throwDecodeError(result, __FUNCTION__);
+            }
+
+            return result.written;
+        }
+
+        /// Decode into `out` without throwing; `out` ends up holding the
+        /// bytes decoded in front of any error. Malformed lengths and
+        /// padding are rejected before `out` is touched, and reusing `out`
+        /// across calls keeps the error path free of allocations.
+        template <typename Output>
+        static DecodeResult try_decode(const char* data,
+            const size_t data_len, Output& out,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            DecodeResult result = try_decode_into(
+                nullptr, 0, data, data_len, padding, alphabet);
+            if (result.code == eResultCode::InvalidBufferSize)
+            {
+                out.resize(geometry::decoded_length(data, data_len));
+                result = try_decode_into(output_data(out, 0), out.size(),
+                    data, data_len, padding, alphabet);
+            }
+            out.resize(result.written);
+
+            return result;
+        }
+
+        /// The checks of try_decode_into() without writing anything: the
+        /// same code and offset on failure, and on success `written` is the
+        /// length a decode would write.
+        static DecodeResult validate(const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return validate_groups<BitsPerChar>(data, data_len,
+                alphabet.decoding(), padding,
+                [&alphabet](const char* src, const size_t src_len)
+                {
+                    return alphabet.validate_bulk(src, src_len);
+                });
+        }
+
+        static std::string encode(const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            std::string encoded(encoded_length(data_len, padding), '\0');
+            encode_into(&encoded[0], encoded.size(),
+                data, data_len, padding, alphabet);
+
+            return encoded;
+        }
+
+        static std::string decode(const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            std::string decoded(
+                geometry::decoded_length(data, data_len), '\0');
+            decoded.resize(decode_into(&decoded[0], decoded.size(),
+                data, data_len, padding, alphabet));
+
+            return decoded;
+        }
+
+        /// Append the encoding of `data` to `out`, growing it in place.
+        template <typename Output>
+        static void encode_append(Output& out,
+            const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const size_t old_len = out.size();
+            out.resize(old_len + encoded_length(data_len, padding));
+            encode_into(output_data(out, old_len), out.size() - old_len,
+                data, data_len, padding, alphabet);
+        }
+
+        /// Append the decoding of `data` to `out`, growing it in place.
+        /// `out` keeps its original contents if decoding fails.
+        template <typename Output>
+        static void decode_append(Output& out,
+            const char* data, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const size_t old_len = out.size();
+            out.resize(old_len + geometry::decoded_length(data, data_len));
+            const DecodeResult result = try_decode_into(
+                output_data(out, old_len), out.size() - old_len,
+                data, data_len, padding, alphabet);
+            if (!result)
+            {
+                out.resize(old_len);
+                throwDecodeError(result, __FUNCTION__);
+            }
+            out.resize(old_len + result.written);
+        }
+
+        /// Encode the `data_len` bytes stored at the tail of `buf`, a buffer
+        /// of encoded_length(data_len, padding) characters, over themselves;
+        /// returns that length. Going front to back, the output never
+        /// overtakes the input still to be read.
+        static size_t encode_inplace(char* buf, const size_t data_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const size_t encoded_len = encoded_length(data_len, padding);
+
+            return encode_into(buf, encoded_len,
+                buf + (encoded_len - data_len), data_len, padding, alphabet);
+        }
+
+        /// Decode the `text_len` characters at `buf` over themselves;
+        /// returns the decoded length. On failure `buf` holds a partly
+        /// decoded prefix.
+        static size_t decode_inplace(char* buf, const size_t text_len,
+            const ePadding padding = Padding,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return decode_into(
+                buf, text_len, buf, text_len, padding, alphabet);
+        }
+
+        /// Decode text with ASCII whitespace anywhere, such as MIME parts
+        /// and PEM bodies, in a single pass (see decode_spaced()). Padding
+        /// is required unless `lenience` is eLenience::Forgiving.
+        static DecodeResult try_decode_lenient_into(char* dst,
+            const size_t dst_cap, const char* data, const size_t data_len,
+            const eLenience lenience = eLenience::Whitespace,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return decode_spaced<geometry::chars_per_group,
+                geometry::bytes_per_group>(
+                dst, dst_cap, data, data_len, lenience,
+                [&alphabet](char* out, size_t cap, const char* text,
+                    size_t len)
+                {
+                    return try_decode_into(out, cap, text, len,
+                        ePadding::Required, alphabet);
+                });
+        }
+
+        static size_t decode_lenient_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const eLenience lenience = eLenience::Whitespace,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const DecodeResult result = try_decode_lenient_into(
+                dst, dst_cap, data, data_len, lenience, alphabet);
+            if (!result)
+            {
+                throwDecodeError(result, __FUNCTION__);
+            }
+
+            return result.written;
+        }
+
+        template <typename Output>
+        static DecodeResult try_decode_lenient(
+            const char* data, const size_t data_len, Output& out,
+            const eLenience lenience = eLenience::Whitespace,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            out.resize(lenient_capacity(data_len));
+            const DecodeResult result = try_decode_lenient_into(
+                output_data(out, 0), out.size(), data, data_len,
+                lenience, alphabet);
+            out.resize(result.written);
+
+            return result;
+        }
+
+        /// Append the decoding of `data` to `out`, which keeps its original
+        /// contents if decoding fails (try_decode_lenient() keeps the bytes
+        /// in front of the error).
+        template <typename Output>
+        static void decode_lenient_append(Output& out,
+            const char* data, const size_t data_len,
+            const eLenience lenience = eLenience::Whitespace,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            const size_t old_len = out.size();
+            out.resize(old_len + lenient_capacity(data_len));
+            const DecodeResult result = try_decode_lenient_into(
+                output_data(out, old_len), out.size() - old_len,
+                data, data_len, lenience, alphabet);
+            if (!result)
+            {
+                out.resize(old_len);
+                throwDecodeError(result, __FUNCTION__);
+            }
+            out.resize(old_len + result.written);
+        }
+
+        /// Same output as encode_into() with `Padding`, computed on up to
+        /// `threads` threads (0: one per hardware thread). Slices are cut at
+        /// group boundaries, and inputs under parallel_min_slice per thread
+        /// stay on the calling thread.
+        static size_t encode_parallel_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const size_t threads = 0, const Alphabet& alphabet = Alphabet{})
+        {
+            const size_t encoded_len = encoded_length(data_len);
+            if (dst_cap < encoded_len)
+            {
+                throwRuntimeError(
+                    eResultCode::InvalidBufferSize, __FUNCTION__);
+            }
+
+            encode_slices<geometry::bytes_per_group,
+                geometry::chars_per_group>(
+                dst, encoded_len, data, data_len,
+                parallel_slices(data_len, threads),
+                [&alphabet](char* out, size_t cap, const char* in, size_t len)
+                {
+                    encode_into(out, cap, in, len, Padding, alphabet);
+                });
+
+            return encoded_len;
+        }
+
+        static std::string encode_parallel(const char* data,
+            const size_t data_len, const size_t threads = 0,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            std::string encoded(encoded_length(data_len), '\0');
+            encode_parallel_into(&encoded[0], encoded.size(),
+                data, data_len, threads, alphabet);
+
+            return encoded;
+        }
+
+        /// Same output as try_decode_into() with `Padding`, sliced as in
+        /// encode_parallel_into(). The lookups of `alphabet` are called
+        /// from several threads and must not throw.
+        static DecodeResult try_decode_parallel_into(char* dst,
+            const size_t dst_cap, const char* data, const size_t data_len,
+            const size_t threads = 0, const Alphabet& alphabet = Alphabet{})
+        {
+            return decode_slices<geometry::chars_per_group,
+                geometry::bytes_per_group>(
+                dst, dst_cap, data, data_len,
+                geometry::decoded_length(data, data_len),
+                parallel_slices(data_len, threads),
+                [&alphabet](char* out, size_t cap, const char* in, size_t len)
+                {
+                    return try_decode_into(
+                        out, cap, in, len, Padding, alphabet);
+                });
+        }
+
+        static size_t decode_parallel_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len,
+            const size_t threads = 0, const Alphabet& alphabet = Alphabet{})
+        {
+            const DecodeResult result = try_decode_parallel_into(
+                dst, dst_cap, data, data_len, threads, alphabet);
+            if (!result)
+            {
+                throwDecodeError(result, __FUNCTION__);
+            }
+
+            return result.written;
+        }
+
+        static std::string decode_parallel(const char* data,
+            const size_t data_len, const size_t threads = 0,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            std::string decoded(
+                geometry::decoded_length(data, data_len), '\0');
+            decode_parallel_into(&decoded[0], decoded.size(),
+                data, data_len, threads, alphabet);
+
+            return decoded;
+        }
+
+        /// Sum of the encoded lengths of `rows` rows of a batch, every row
+        /// encoded on its own with `Padding`.
+        static size_t encoded_batch_length(
+            const size_t* offsets, const size_t rows)
+        {
+            size_t total = 0;
+            for (size_t i = 0; i < rows; i++)
+            {
+                total += encoded_length(offsets[i + 1] - offsets[i]);
+            }
+
+            return total;
+        }
+
+        /// Room for decoding `rows` rows; at least the sum of their lengths.
+        static constexpr size_t decoded_batch_capacity(
+            const size_t* offsets, const size_t rows)
+        {
+            return (offsets[rows] - offsets[0]) * BitsPerChar / 8;
+        }
+
+        /// Encode `rows` rows into caller memory; `dst_offsets` receives
+        /// rows + 1 entries. Returns the number of characters written.
+        static size_t encode_batch_into(char* dst, const size_t dst_cap,
+            size_t* dst_offsets, const char* data, const size_t* offsets,
+            const size_t rows, const Alphabet& alphabet = Alphabet{})
+        {
+            if (dst_cap < encoded_batch_length(offsets, rows))
+            {
+                throwRuntimeError(
+                    eResultCode::InvalidBufferSize, __FUNCTION__);
+            }
+
+            return encode_rows(dst, dst_cap, dst_offsets, data, offsets, rows,
+                [&alphabet](char* out, size_t cap, const char* in, size_t len)
+                {
+                    return encode_into(out, cap, in, len, Padding, alphabet);
+                });
+        }
+
+        /// Encode every row of `column` into `out`. Reusing `out` across
+        /// batches keeps the loop free of allocations.
+        static void encode_batch(const Column& column, Column& out,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            out.data.resize(
+                encoded_batch_length(column.offsets.data(), column.rows()));
+            out.offsets.resize(column.offsets.size());
+            encode_batch_into(&out.data[0], out.data.size(),
+                out.offsets.data(), column.data.data(),
+                column.offsets.data(), column.rows(), alphabet);
+        }
+
+        static Column encode_batch(
+            const Column& column, const Alphabet& alphabet = Alphabet{})
+        {
+            Column encoded{};
+            encode_batch(column, encoded, alphabet);
+
+            return encoded;
+        }
+
+        /// Decode `rows` rows into caller memory without throwing; `dst`
+        /// needs decoded_batch_capacity() bytes and `dst_offsets` rows + 1
+        /// entries. A row that fails is left empty, and `results` (rows
+        /// entries, may be nullptr) receives the result of every row.
+        /// Returns the number of failed rows.
+        static size_t try_decode_batch_into(char* dst, const size_t dst_cap,
+            size_t* dst_offsets, const char* data, const size_t* offsets,
+            const size_t rows, DecodeResult* results = nullptr,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            return decode_rows(dst, dst_cap, dst_offsets, data, offsets, rows,
+                [&alphabet](char* out, size_t cap, const char* in, size_t len)
+                {
+                    return try_decode_into(
+                        out, cap, in, len, Padding, alphabet);
+                },
+                [results](size_t row, const DecodeResult& result)
+                {
+                    if (results != nullptr)
+                    {
+                        results[row] = result;
+                    }
+                });
+        }
+
+        /// Decode every row of `column` into `out` without throwing; failed
+        /// rows are left empty and listed in `errors`. Reusing `out` &
+        /// `errors` across batches keeps the loop free of allocations.
+        /// Returns the number of failed rows.
+        static size_t try_decode_batch(const Column& column, Column& out,
+            std::vector<RowError>& errors,
+            const Alphabet& alphabet = Alphabet{})
+        {
+            errors.clear();
+            out.data.resize(
+                decoded_batch_capacity(column.offsets.data(), column.rows()));
+            out.offsets.resize(column.offsets.size());
+
+            const size_t failed = decode_rows(&out.data[0], out.data.size(),
+                out.offsets.data(), column.data.data(), column.offsets.data(),
+                column.rows(),
+                [&alphabet](char* dst, size_t cap, const char* src, size_t len)
+                {
+                    return try_decode_into(
+                        dst, cap, src, len, Padding, alphabet);
+                },
+                [&errors](size_t row, const DecodeResult& result)
+                {
+                    if (!result)
+                    {
+                        errors.push_back(RowError{ row, result });
+                    }
+                });
+            out.data.resize(out.offsets.back());
+
+            return failed;
+        }
+
+        /// Decode every row of `column`; throws for the first row that
+        /// fails, with the offset inside that row.
+        static Column decode_batch(
+            const Column& column, const Alphabet& alphabet = Alphabet{})
+        {
+            Column decoded{};
+            std::vector<RowError> errors{};
+            if (try_decode_batch(column, decoded, errors, alphabet) != 0)
+            {
+                throwDecodeError(errors.front().result, __FUNCTION__);
+            }
+
+            return decoded;
+        }
+
+        /// Streaming encoder: feed chunks of any size with update() and
+        /// close with finalize(); the concatenated output equals encode()
+        /// of the concatenated input. Only the bytes of an incomplete group
+        /// are kept between calls.
+        class Encoder
+        {
+        public:
+            explicit Encoder(const Alphabet& alphabet = Alphabet{})
+                : alphabet_(alphabet)
+            {
+            }
+
+            /// Characters update() produces for `data_len` more bytes.
+            size_t update_length(const size_t data_len) const
+            {
+                return (carry_len_ + data_len) / geometry::bytes_per_group *
+                    geometry::chars_per_group;
+            }
+
+            /// Characters finalize() produces.
+            size_t finalize_length() const
+            {
+                return encoded_length(carry_len_);
+            }
+
+            /// Encode every complete group into caller memory;
+            /// returns the number of characters written.
+            size_t update_into(char* dst, const size_t dst_cap,
+                const char* data, const size_t data_len)
+            {
+                constexpr size_t group = geometry::bytes_per_group;
+
+                if (dst_cap < update_length(data_len))
+                {
+                    throwRuntimeError(
+                        eResultCode::InvalidBufferSize, __FUNCTION__);
+                }
+
+                size_t written = 0;
+                size_t pos = 0;
+                if (carry_len_ != 0)
+                {
+                    while (carry_len_ < group && pos < data_len)
+                    {
+                        carry_[carry_len_++] = data[pos++];
+                    }
+                    if (carry_len_ < group)
+                    {
+                        return 0;
+                    }
+
+                    written += encode_into(
+                        dst, dst_cap, carry_, group, Padding, alphabet_);
+                    carry_len_ = 0;
+                }
+
+                const size_t whole = (data_len - pos) / group * group;
+                written += encode_into(dst + written, dst_cap - written,
+                    data + pos, whole, Padding, alphabet_);
+                pos += whole;
+
+                while (pos < data_len)
+                {
+                    carry_[carry_len_++] = data[pos++];
+                }
+
+                return written;
+            }
+
+            /// Append the characters for every complete group to `out`.
+            template <typename Output>
+            void update(const char* data, const size_t data_len, Output& out)
+            {
+                const size_t old_len = out.size();
+                out.resize(old_len + update_length(data_len));
+                update_into(output_data(out, old_len), out.size() - old_len,
+                    data, data_len);
+            }
+
+            std::string update(const ByteView chunk)
+            {
+                std::string out{};
+                update(chunk.data(), chunk.size(), out);
+
+                return out;
+            }
+
+            /// Encode the carried-over bytes with padding and reset the
+            /// encoder; returns the number of characters written.
+            size_t finalize_into(char* dst, const size_t dst_cap)
+            {
+                const size_t written = encode_into(
+                    dst, dst_cap, carry_, carry_len_, Padding, alphabet_);
+                carry_len_ = 0;
+
+                return written;
+            }
+
+            template <typename Output>
+            void finalize(Output& out)
+            {
+                const size_t old_len = out.size();
+                out.resize(old_len + finalize_length());
+                finalize_into(output_data(out, old_len), out.size() - old_len);
+            }
+
+            std::string finalize()
+            {
+                std::string out{};
+                finalize(out);
+
+                return out;
+            }
+
+            void reset()
+            {
+                carry_len_ = 0;
+            }
+
+        private:
+            Alphabet alphabet_;
+            char carry_[geometry::bytes_per_group] = { 0, };
+            size_t carry_len_ = 0;
+        };
+
+        /// Streaming decoder: feed chunks of any size with update() and
+        /// close with finalize(). Whole groups are decoded as soon as they
+        /// arrive and an invalid character is reported with its absolute
+        /// offset in the stream, so a bad upload is rejected without
+        /// buffering it. Only the characters of an incomplete group are
+        /// kept between calls, and nothing may follow the padded group.
+        /// `Padding` applies as in decode(): unless padding is required,
+        /// finalize() decodes a short last group, and ePadding::None
+        /// rejects '='.
+        class Decoder
+        {
+        public:
+            explicit Decoder(const Alphabet& alphabet = Alphabet{})
+                : Decoder(alphabet, alphabet.decoding())
+            {
+            }
+
+            /// Decoding through `values`, e.g. built from an encoding table
+            /// chosen at run time, and the bulk kernel of `alphabet`.
+            Decoder(const Alphabet& alphabet, const DecodeTable& values)
+                : alphabet_(alphabet)
+                , values_(values)
+            {
+            }
+
+            /// Upper bound of the bytes update() produces for `text_len`
+            /// more characters.
+            size_t update_length(const size_t text_len) const
+            {
+                return (carry_len_ + text_len) / geometry::chars_per_group *
+                    geometry::bytes_per_group;
+            }
+
+            /// Number of characters consumed so far.
+            size_t offset() const
+            {
+                return offset_;
+            }
+
+            /// Decode every complete group into caller memory;
+            /// returns the number of bytes written.
+            size_t update_into(char* dst, const size_t dst_cap,
+                const char* data, const size_t data_len)
+            {
+                constexpr size_t group = geometry::chars_per_group;
+
+                if (dst_cap < update_length(data_len))
+                {
+                    throwRuntimeError(
+                        eResultCode::InvalidBufferSize, __FUNCTION__);
+                }
+
+                char* const dst_begin = dst;
+                size_t pos = 0;
+                while (pos < data_len)
+                {
+                    if (carry_len_ == 0 && !finished_)
+                    {
+                        // Whole groups straight from the chunk
+                        const size_t whole = (data_len - pos) / group * group;
+                        const size_t consumed =
+                            alphabet_.decode_bulk(data + pos, whole, dst);
+                        dst += consumed / group * geometry::bytes_per_group;
+                        pos += consumed;
+                        offset_ += consumed;
+
+                        while (data_len - pos >= group)
+                        {
+                            uint64_t bits = 0;
+                            uint32_t invalid = 0;
+                            for (size_t i = 0; i < group; i++)
+                            {
+                                const uint8_t v = values_(data[pos + i]);
+                                invalid |= v;
+                                bits = (bits << BitsPerChar) | v;
+                            }
+                            if (invalid & 0x80)
+                            {
+                                break;  // padding or error, see flush()
+                            }
+
+                            store_be<geometry::bytes_per_group>(dst, bits);
+                            dst += geometry::bytes_per_group;
+                            pos += group;
+                            offset_ += group;
+                        }
+
+                        if (pos == data_len)
+                        {
+                            break;
+                        }
+                    }
+
+                    // Without padding (Base16) a character can be checked
+                    // as it comes, not only once its group is complete.
+                    if (finished_ || (geometry::max_padding == 0 &&
+                                      values_(data[pos]) == invalid_value))
+                    {
+                        throwRuntimeError(eResultCode::InvalidCharacter,
+                            __FUNCTION__, offset_);
+                    }
+
+                    carry_[carry_len_++] = data[pos++];
+                    offset_++;
+                    if (carry_len_ == group)
+                    {
+                        dst += flush(dst, group);
+                    }
+                }
+
+                return static_cast<size_t>(dst - dst_begin);
+            }
+
+            /// Append the bytes of every complete group to `out`.
+            /// `out` keeps its original contents if decoding fails.
+            template <typename Output>
+            void update(const char* data, const size_t data_len, Output& out)
+            {
+                append(out, update_length(data_len),
+                    [this, data, data_len](char* dst, const size_t dst_cap)
+                    {
+                        return update_into(dst, dst_cap, data, data_len);
+                    });
+            }
+
+            std::string update(const ByteView chunk)
+            {
+                std::string out{};
+                update(chunk.data(), chunk.size(), out);
+
+                return out;
+            }
+
+            /// Bytes finalize() produces: those of a short last group,
+            /// which `Padding` may leave unpadded.
+            size_t finalize_length() const
+            {
+                return carry_len_ * BitsPerChar / 8;
+            }
+
+            /// Check that the stream ended on a group boundary, or on a
+            /// short last group unless padding is required, decode that
+            /// group into caller memory and reset the decoder; returns the
+            /// number of bytes written.
+            size_t finalize_into(char* dst, const size_t dst_cap)
+            {
+                const size_t chars = carry_len_;
+                if (chars != 0 && (Padding == ePadding::Required ||
+                                   geometry::max_padding == 0 ||
+                                   !geometry::valid_rest(chars) ||
+                                   carry_[chars - 1] == '='))
+                {
+                    const size_t offset = offset_;
+                    reset();
+                    throwRuntimeError(
+                        eResultCode::InvalidLength, __FUNCTION__, offset);
+                }
+                if (dst_cap < finalize_length())
+                {
+                    throwRuntimeError(
+                        eResultCode::InvalidBufferSize, __FUNCTION__);
+                }
+
+                const size_t written = (chars != 0) ? flush(dst, chars) : 0;
+                reset();
+
+                return written;
+            }
+
+            /// Append the bytes of a short last group to `out`, which keeps
+            /// its original contents if decoding fails.
+            template <typename Output>
+            void finalize(Output& out)
+            {
+                append(out, finalize_length(),
+                    [this](char* dst, const size_t dst_cap)
+                    {
+                        return finalize_into(dst, dst_cap);
+                    });
+            }
+
+            std::string finalize()
+            {
+                std::string out{};
+                finalize(out);
+
+                return out;
+            }
+
+            void reset()
+            {
+                carry_len_ = 0;
+                offset_ = 0;
+                finished_ = false;
+            }
+
+        private:
+            /// Grow `out` by up to `len` bytes written by `write(dst, cap)`,
+            /// which returns the number it wrote; on an error `out` is
+            /// restored before it propagates.
+            template <typename Output, typename Write>
+            static void append(
+                Output& out, const size_t len, const Write& write)
+            {
+                const size_t old_len = out.size();
+                out.resize(old_len + len);
+#if defined(BASEXX_EXCEPTIONS)
+                try
+                {
+                    out.resize(old_len + write(output_data(out, old_len), len));
+                }
+                catch (...)
+                {
+                    out.resize(old_len);
+                    throw;
+                }
+#else  // defined(BASEXX_EXCEPTIONS)
+                out.resize(old_len + write(output_data(out, old_len), len));
+#endif  // defined(BASEXX_EXCEPTIONS)
+            }
+
+            /// Decode the `len` carried characters: a whole group, which
+            /// may be the padded last one, or the unpadded short last group.
+            /// '=' is only padding if `Padding` allows it.
+            size_t flush(char* dst, const size_t len)
+            {
+                constexpr size_t group = geometry::chars_per_group;
+                const size_t base = offset_ - len;
+
+                uint64_t bits = 0;
+                size_t chars = len;
+                for (size_t i = 0; i < len; i++)
+                {
+                    if (carry_[i] == '=' && Padding != ePadding::None &&
+                        len == group && i + geometry::max_padding >= group)
+                    {
+                        chars = i;
+                        break;
+                    }
+
+                    const uint8_t v = values_(carry_[i]);
+                    if (v & 0x80)
+                    {
+                        throwRuntimeError((carry_[i] == '=')
+                            ? eResultCode::InvalidPaddingCount
+                            : eResultCode::InvalidCharacter,
+                            __FUNCTION__, base + i);
+                    }
+                    bits = (bits << BitsPerChar) | v;
+                }
+
+                for (size_t i = chars; i < len; i++)
+                {
+                    if (carry_[i] != '=')
+                    {
+                        throwRuntimeError(eResultCode::InvalidCharacter,
+                            __FUNCTION__, base + i);
+                    }
+                }
+
+                // Padding completes only the shortest groups for their
+                // bytes, e.g. not 3 or 6 characters in Base32
+                if (!geometry::valid_rest(chars))
+                {
+                    throwRuntimeError(eResultCode::InvalidPaddingCount,
+                        __FUNCTION__, base + chars);
+                }
+
+                carry_len_ = 0;
+                finished_ = (chars < group);
+
+                const size_t bit_count = chars * BitsPerChar;
+                const size_t bytes = bit_count / 8;
+                for (size_t i = 0; i < bytes; i++)
+                {
+                    dst[i] =
+                        static_cast<char>(bits >> (bit_count - 8 - 8 * i));
+                }
+
+                return bytes;
+            }
+
+            Alphabet alphabet_;
+            DecodeTable values_;
+            char carry_[geometry::chars_per_group] = { 0, };
+            size_t carry_len_ = 0;
+            size_t offset_ = 0;
+            bool finished_ = false;
+        };
+
+    private:
+        /// Room for the whitespace-tolerant decoding of `data_len`
+        /// characters.
+        static constexpr size_t lenient_capacity(const size_t data_len)
+        {
+            return (data_len + geometry::chars_per_group - 1) /
+                geometry::chars_per_group * geometry::bytes_per_group;
+        }
+    };
+
+
+    /// ========================================================================
+    /// Table Lookup Kernels
+    /// ------------------------------------------------------------------------
+    /// Reverse lookup of any alphabet in vector registers, for the alphabets
+    /// chosen at run time (see CustomAlphabet). One pshufb looks up 16
+    /// entries, so the ASCII half of a DecodeTable is split into 8 rows by
+    /// high nibble. Row k is looked up at (c - 16 * k), which zeroes every
+    /// lane under 16 * k (bit 7 set), and holds the XOR of table row k with
+    /// the row before it: the lookups of rows 0 ~ h XOR back to table row h
+    /// for a character of high nibble h. Rows equal to the one before them
+    /// drop out, e.g. 5 of the 8 are left for Base32.
+    /// ========================================================================
+
+    struct NibbleLut
+    {
+        DecodeTable table;    // for the scalar loops
+        uint8_t rows[8][16];  // XOR of each table row with the row before it
+        uint8_t offsets[8];   // 16 * k of each entry of rows
+        size_t count;
+    };
+
+    constexpr NibbleLut make_nibble_lut(const DecodeTable& table)
+    {
+        NibbleLut lut{};
+        lut.table = table;
+
+        uint8_t prev[16] = { 0, };
+        for (size_t l = 0; l < 16; l++)
+        {
+            prev[l] = invalid_value;
+        }
+        for (size_t k = 0; k < 8; k++)
+        {
+            uint8_t delta = 0;
+            for (size_t l = 0; l < 16; l++)
+            {
+                const uint8_t value = table.values[k * 16 + l];
+                lut.rows[lut.count][l] = value ^ prev[l];
+                delta |= value ^ prev[l];
+                prev[l] = value;
+            }
+            if (delta != 0)
+            {
+                lut.offsets[lut.count++] = static_cast<uint8_t>(k * 16);
+            }
+        }
+
+        return lut;
+    }
+
+    /// Number of leading characters of `src` in the alphabet of `table`,
+    /// counted 8 at a time.
+    inline size_t validate_table_scalar(const char* src,
+        const size_t src_len, const DecodeTable& table)
+    {
+        size_t pos = 0;
+        for (; pos + 8 <= src_len; pos += 8)
+        {
+            const uint32_t invalid =
+                table(src[pos]) | table(src[pos + 1]) |
+                table(src[pos + 2]) | table(src[pos + 3]) |
+                table(src[pos + 4]) | table(src[pos + 5]) |
+                table(src[pos + 6]) | table(src[pos + 7]);
+            if (invalid & 0x80)
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+#if defined(BASEXX_X86_SIMD)
+    /// Values of 16 characters. Characters outside the alphabet set bit 7
+    /// of `error`, which is only ever OR-ed; those >= 0x80 also pick up rows
+    /// they do not belong to, so their own bit 7 goes there as well.
+    BASEXX_TARGET_SSE41
+    inline __m128i translate_ssse3(
+        const __m128i in, const NibbleLut& lut, __m128i& error)
+    {
+        __m128i values = _mm_set1_epi8(static_cast<char>(invalid_value));
+        for (size_t k = 0; k < lut.count; k++)
+        {
+            const __m128i row =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.rows[k]));
+            values = _mm_xor_si128(values, _mm_shuffle_epi8(row, _mm_sub_epi8(
+                in, _mm_set1_epi8(static_cast<char>(lut.offsets[k])))));
+        }
+        error = _mm_or_si128(error, _mm_or_si128(values, in));
+
+        return values;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline __m256i translate_avx2(
+        const __m256i in, const NibbleLut& lut, __m256i& error)
+    {
+        __m256i values = _mm256_set1_epi8(static_cast<char>(invalid_value));
+        for (size_t k = 0; k < lut.count; k++)
+        {
+            const __m256i row = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.rows[k])));
+            values = _mm256_xor_si256(values, _mm256_shuffle_epi8(row,
+                _mm256_sub_epi8(in,
+                    _mm256_set1_epi8(static_cast<char>(lut.offsets[k])))));
+        }
+        error = _mm256_or_si256(error, _mm256_or_si256(values, in));
+
+        return values;
+    }
+
+    /// translate_*() of the 4 vectors at `src`, returned in `values`. Every
+    /// row is loaded once for all of them, and their chains of lookups run
+    /// side by side.
+    BASEXX_TARGET_SSE41
+    inline void translate_x4_ssse3(const char* src,
+        const NibbleLut& lut, __m128i (&values)[4], __m128i& error)
+    {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src);
+        const __m128i in0 = _mm_loadu_si128(in);
+        const __m128i in1 = _mm_loadu_si128(in + 1);
+        const __m128i in2 = _mm_loadu_si128(in + 2);
+        const __m128i in3 = _mm_loadu_si128(in + 3);
+
+        __m128i v0 = _mm_set1_epi8(static_cast<char>(invalid_value));
+        __m128i v1 = v0;
+        __m128i v2 = v0;
+        __m128i v3 = v0;
+        for (size_t k = 0; k < lut.count; k++)
+        {
+            const __m128i row =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.rows[k]));
+            const __m128i offset =
+                _mm_set1_epi8(static_cast<char>(lut.offsets[k]));
+            v0 = _mm_xor_si128(v0,
+                _mm_shuffle_epi8(row, _mm_sub_epi8(in0, offset)));
+            v1 = _mm_xor_si128(v1,
+                _mm_shuffle_epi8(row, _mm_sub_epi8(in1, offset)));
+            v2 = _mm_xor_si128(v2,
+                _mm_shuffle_epi8(row, _mm_sub_epi8(in2, offset)));
+            v3 = _mm_xor_si128(v3,
+                _mm_shuffle_epi8(row, _mm_sub_epi8(in3, offset)));
+        }
+
+        const __m128i error01 =
+            _mm_or_si128(_mm_or_si128(v0, in0), _mm_or_si128(v1, in1));
+        const __m128i error23 =
+            _mm_or_si128(_mm_or_si128(v2, in2), _mm_or_si128(v3, in3));
+        error = _mm_or_si128(error, _mm_or_si128(error01, error23));
+        values[0] = v0;
+        values[1] = v1;
+        values[2] = v2;
+        values[3] = v3;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline void translate_x4_avx2(const char* src,
+        const NibbleLut& lut, __m256i (&values)[4], __m256i& error)
+    {
+        const __m256i* in = reinterpret_cast<const __m256i*>(src);
+        const __m256i in0 = _mm256_loadu_si256(in);
+        const __m256i in1 = _mm256_loadu_si256(in + 1);
+        const __m256i in2 = _mm256_loadu_si256(in + 2);
+        const __m256i in3 = _mm256_loadu_si256(in + 3);
+
+        __m256i v0 = _mm256_set1_epi8(static_cast<char>(invalid_value));
+        __m256i v1 = v0;
+        __m256i v2 = v0;
+        __m256i v3 = v0;
+        for (size_t k = 0; k < lut.count; k++)
+        {
+            const __m256i row = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.rows[k])));
+            const __m256i offset =
+                _mm256_set1_epi8(static_cast<char>(lut.offsets[k]));
+            v0 = _mm256_xor_si256(v0,
+                _mm256_shuffle_epi8(row, _mm256_sub_epi8(in0, offset)));
+            v1 = _mm256_xor_si256(v1,
+                _mm256_shuffle_epi8(row, _mm256_sub_epi8(in1, offset)));
+            v2 = _mm256_xor_si256(v2,
+                _mm256_shuffle_epi8(row, _mm256_sub_epi8(in2, offset)));
+            v3 = _mm256_xor_si256(v3,
+                _mm256_shuffle_epi8(row, _mm256_sub_epi8(in3, offset)));
+        }
+
+        const __m256i error01 = _mm256_or_si256(
+            _mm256_or_si256(v0, in0), _mm256_or_si256(v1, in1));
+        const __m256i error23 = _mm256_or_si256(
+            _mm256_or_si256(v2, in2), _mm256_or_si256(v3, in3));
+        error = _mm256_or_si256(error, _mm256_or_si256(error01, error23));
+        values[0] = v0;
+        values[1] = v1;
+        values[2] = v2;
+        values[3] = v3;
+    }
+
+    /// Validation kernels: the lookups alone, returning the number of
+    /// characters in front of the first block that holds one outside the
+    /// alphabet.
+    BASEXX_TARGET_SSE41
+    inline size_t validate_custom_ssse3(const char* src,
+        const size_t src_len, const NibbleLut& lut)
+    {
+        const __m128i bit7 = _mm_set1_epi8(static_cast<char>(0x80));
+
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m128i values[4];
+            __m128i error = _mm_setzero_si128();
+            translate_x4_ssse3(src + pos, lut, values, error);
+            if (!_mm_testz_si128(error, bit7))
+            {
+                break;
+            }
+        }
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i error = _mm_setzero_si128();
+            translate_ssse3(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                lut, error);
+            if (!_mm_testz_si128(error, bit7))
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t validate_custom_avx2(const char* src,
+        const size_t src_len, const NibbleLut& lut)
+    {
+        const __m256i bit7 = _mm256_set1_epi8(static_cast<char>(0x80));
+
+        size_t pos = 0;
+        for (; pos + 128 <= src_len; pos += 128)
+        {
+            __m256i values[4];
+            __m256i error = _mm256_setzero_si256();
+            translate_x4_avx2(src + pos, lut, values, error);
+            if (!_mm256_testz_si256(error, bit7))
+            {
+                break;
+            }
+        }
+
+        return pos + validate_custom_ssse3(src + pos, src_len - pos, lut);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+    /// validate_custom_*() of the active SIMD level.
+    inline size_t validate_custom(
+        const char* src, const size_t src_len, const NibbleLut& lut)
+    {
+#if defined(BASEXX_X86_SIMD)
+        switch (simd_level())
+        {
+        case eSimdLevel::AVX2:
+        case eSimdLevel::AVX512BW:
+            return validate_custom_avx2(src, src_len, lut);
+        case eSimdLevel::SSE41:
+            return validate_custom_ssse3(src, src_len, lut);
+        default:
+            break;
+        }
+#endif  // defined(BASEXX_X86_SIMD)
+
+        return validate_table_scalar(src, src_len, lut.table);
+    }
+
+namespace _64_
+{
+    /// ========================================================================
+    /// Base64[-URLsafe] Encoding/Decoding Implementation
+    /// ========================================================================
+
+    /// The Base 64 Alphabet Table
+    /// https://datatracker.ietf.org/doc/html/rfc4648#section-4
+    ///
+    static constexpr uint8_t encoding_table[64] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
+        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
+        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
+        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 24 ~ 31
+        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 32 ~ 39
+        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 40 ~ 47
+        'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 48 ~ 55
+        '4', '5', '6', '7', '8', '9', '+', '/',  // 56 ~ 63
+    };
+
+    /// The Base 64 Alphabet Table (URL and Filename safe)
+    /// https://datatracker.ietf.org/doc/html/rfc4648#section-5
+    ///
+    static constexpr uint8_t urlsafe_encoding_table[64] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
+        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
+        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
+        'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',  // 24 ~ 31
+        'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n',  // 32 ~ 39
+        'o', 'p', 'q', 'r', 's', 't', 'u', 'v',  // 40 ~ 47
+        'w', 'x', 'y', 'z', '0', '1', '2', '3',  // 48 ~ 55
+        '4', '5', '6', '7', '8', '9', '-', '_',  // 56 ~ 63
+    };
+
+    /// Reverse tables: character -> 6-bit value, invalid_value otherwise
+    static constexpr DecodeTable decode_table =
+        make_decode_table(encoding_table);
+    static constexpr DecodeTable urlsafe_decode_table =
+        make_decode_table(urlsafe_encoding_table);
+
+    /// Length of the encoding of `data_len` bytes, padded by default.
+    constexpr size_t encoded_length(const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Geometry<6>::encoded_length(data_len, padding);
+    }
+
+    /// Exact decoded length of an encoded text. Only the trailing padding is
+    /// inspected; the characters themselves are not validated.
+    constexpr size_t decoded_length(
+        const char* encoded_text, const size_t text_len)
+    {
+        return Geometry<6>::decoded_length(encoded_text, text_len);
+    }
+
+    /// Length & padding checks of a text to decode. Without padding the
+    /// last group may be short, but only 2 or 3 characters long.
+    inline eResultCode check_format(
+        const char* encoded_text, const size_t text_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Geometry<6>::check_format(encoded_text, text_len, padding);
+    }
+
+    /// Value of a character, or invalid_value outside the alphabet.
+    constexpr uint8_t decode_value(const char c) noexcept
+    {
+        return decode_table(c);
+    }
+
+    inline uint8_t decode_char(const char c)
+    {
+        return decode_value_or_throw(decode_value, c, __FUNCTION__);
+    }
+
+    constexpr uint8_t urlsafe_decode_value(const char c) noexcept
+    {
+        return urlsafe_decode_table(c);
+    }
+
+    inline uint8_t urlsafe_decode_char(const char c)
+    {
+        return decode_value_or_throw(urlsafe_decode_value, c, __FUNCTION__);
+    }
+    
+    /// ========================================================================
+    /// SIMD Kernels
+    /// ------------------------------------------------------------------------
+    /// Encode kernels take whole 3-byte groups and return the number of bytes
+    /// consumed; decode kernels take whole quartets and return the number of
+    /// characters consumed, stopping in front of the first invalid block.
+    /// The scalar loops of the Codec engine finish the rest.
+    /// Based on Wojciech Muła & Daniel Lemire, "Faster Base64 Encoding and
+    /// Decoding Using AVX2 Instructions" (https://arxiv.org/abs/1704.00605)
+    /// ========================================================================
+
+    /// Nibble lookup tables used to validate and translate characters.
+    /// A character is invalid when lo[low nibble] & hi[high nibble] != 0.
+    /// roll[] holds the offset that maps a valid character to its 6-bit
+    /// value, indexed by the high nibble. `special` shares its high nibble
+    /// with a symbol of a different offset, so it is looked up at
+    /// (high nibble | 0x08) instead. `table` is the same alphabet for the
+    /// scalar kernels.
+    struct DecodeLut
+    {
+        int8_t lo[16];
+        int8_t hi[16];
+        int8_t roll[16];
+        char special;
+        DecodeTable table;
+    };
+
+    static constexpr DecodeLut decode_lut = {
+        {  // lo
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        },
+        {  // hi
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        },
+        {  // roll
+            0, 0, 19, 4, -65, -65, -71, -71,  // '+' -> 62
+            0, 0, 16, 0, 0, 0, 0, 0,  // '/' -> 63
+        },
+        '/',
+        decode_table,
+    };
+
+    static constexpr DecodeLut urlsafe_decode_lut = {
+        {  // lo
+            0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+            0x11, 0x11, 0x13, 0x3B, 0x3B, 0x3A, 0x3B, 0x33,
+        },
+        {  // hi
+            0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x20,
+            0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        },
+        {  // roll
+            0, 0, 17, 4, -65, -65, -71, -71,  // '-' -> 62
+            0, 0, 0, 0, 0, -32, 0, 0,  // '_' -> 63
+        },
+        '_',
+        urlsafe_decode_table,
+    };
+
+#if defined(BASEXX_X86_SIMD)
+    /// Spread 12 input bytes over 16 lanes and split them into 6-bit indices.
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_reshuffle_ssse3(__m128i in)
+    {
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003F03F0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+
+        return _mm_or_si128(t1, t3);
+    }
+
+    /// Translate 6-bit indices to ASCII.
+    /// `shift_lut` maps each index class to the offset added to the index.
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_translate_ssse3(
+        const __m128i indices, const __m128i shift_lut)
+    {
+        __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+        result = _mm_shuffle_epi8(shift_lut, result);
+
+        return _mm_add_epi8(result, indices);
+    }
+
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_shift_lut_ssse3(const uint8_t* table)
+    {
+        return _mm_setr_epi8(
+            'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+            static_cast<char>(table[62] - 62),
+            static_cast<char>(table[63] - 63),
+            'A', 0, 0);
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t encode_ssse3(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        const __m128i shift_lut = encode_shift_lut_ssse3(table);
+
+        size_t pos = 0;
+        while (src_len - pos >= 16)  // 12 bytes used, 4 bytes read-ahead
+        {
+            const __m128i in = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos));
+            const __m128i out =
+                encode_translate_ssse3(encode_reshuffle_ssse3(in), shift_lut);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), out);
+
+            pos += 12;
+            dst += 16;
+        }
+
+        return pos;
+    }
+
+    /// Encode `lines` lines of `line_len` (>= 16) characters, each followed
+    /// by the `end_len` characters of `line_end`. The last vector of a line
+    /// overlaps the one before it instead of spilling into the next line.
+    /// Reads 4 bytes past the last line.
+    BASEXX_TARGET_SSE41
+    inline void encode_lines_ssse3(const uint8_t* src, size_t lines,
+        const size_t line_len, const char* line_end, const size_t end_len,
+        char* dst, const uint8_t* table)
+    {
+        const __m128i shift_lut = encode_shift_lut_ssse3(table);
+        const size_t line_bytes = line_len / 4 * 3;
+
+        for (; lines != 0; lines--)
+        {
+            for (size_t out = 0; out < line_len; out += 16)
+            {
+                const size_t at = (out + 16 <= line_len) ? out : line_len - 16;
+                const __m128i in = _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(src + at / 4 * 3));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + at),
+                    encode_translate_ssse3(
+                        encode_reshuffle_ssse3(in), shift_lut));
+            }
+
+            src += line_bytes;
+            dst += line_len;
+            for (size_t i = 0; i < end_len; i++)
+            {
+                *dst++ = line_end[i];
+            }
+        }
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    BASEXX_TARGET_AVX2
+    inline __m256i encode_reshuffle_avx2(__m256i in)
+    {
+        in = _mm256_shuffle_epi8(in, _mm256_set_epi8(
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+            10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+        const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00));
+        const __m256i t1 =
+            _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+        const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0));
+        const __m256i t3 =
+            _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+
+        return _mm256_or_si256(t1, t3);
+    }
+
+    BASEXX_TARGET_AVX2
+    inline __m256i encode_translate_avx2(
+        const __m256i indices, const __m256i shift_lut)
+    {
+        __m256i result = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+        result = _mm256_or_si256(
+            result, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+        result = _mm256_shuffle_epi8(shift_lut, result);
+
+        return _mm256_add_epi8(result, indices);
+    }
+
+    /// Load 2 x 12 bytes into the two 128-bit lanes (28 bytes are read).
+    BASEXX_TARGET_AVX2
+    inline __m256i encode_load_avx2(const uint8_t* src)
+    {
+        const __m128i lo =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i hi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 12));
+
+        return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t encode_avx2(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        const __m128i lut = encode_shift_lut_ssse3(table);
+        const __m256i shift_lut = _mm256_broadcastsi128_si256(lut);
+
+        size_t pos = 0;
+        while (src_len - pos >= 52)  // 48 bytes -> 64 chars
+        {
+            const __m256i in_0 = encode_load_avx2(src + pos);
+            const __m256i in_1 = encode_load_avx2(src + pos + 24);
+            const __m256i out_0 =
+                encode_translate_avx2(encode_reshuffle_avx2(in_0), shift_lut);
+            const __m256i out_1 =
+                encode_translate_avx2(encode_reshuffle_avx2(in_1), shift_lut);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), out_0);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 32), out_1);
+
+            pos += 48;
+            dst += 64;
+        }
+
+        while (src_len - pos >= 28)  // 24 bytes -> 32 chars
+        {
+            const __m256i in = encode_load_avx2(src + pos);
+            const __m256i out =
+                encode_translate_avx2(encode_reshuffle_avx2(in), shift_lut);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), out);
+
+            pos += 24;
+            dst += 32;
+        }
+
+        return pos + encode_ssse3(src + pos, src_len - pos, dst, table);
+    }
+
+    /// Same as encode_lines_ssse3() for lines of 32 characters or more.
+    BASEXX_TARGET_AVX2
+    inline void encode_lines_avx2(const uint8_t* src, size_t lines,
+        const size_t line_len, const char* line_end, const size_t end_len,
+        char* dst, const uint8_t* table)
+    {
+        if (line_len < 32)
+        {
+            encode_lines_ssse3(
+                src, lines, line_len, line_end, end_len, dst, table);
+            return;
+        }
+
+        const __m256i shift_lut =
+            _mm256_broadcastsi128_si256(encode_shift_lut_ssse3(table));
+        const size_t line_bytes = line_len / 4 * 3;
+
+        for (; lines != 0; lines--)
+        {
+            for (size_t out = 0; out < line_len; out += 32)
+            {
+                const size_t at = (out + 32 <= line_len) ? out : line_len - 32;
+                const __m256i in = encode_load_avx2(src + at / 4 * 3);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + at),
+                    encode_translate_avx2(
+                        encode_reshuffle_avx2(in), shift_lut));
+            }
+
+            src += line_bytes;
+            dst += line_len;
+            for (size_t i = 0; i < end_len; i++)
+            {
+                *dst++ = line_end[i];
+            }
+        }
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    /// Translate 16 characters to 6-bit values.
+    /// Invalid characters set bits in `error`, which is only ever OR-ed.
+    BASEXX_TARGET_SSE41
+    inline __m128i decode_translate_ssse3(const __m128i in,
+        const __m128i lut_lo, const __m128i lut_hi, const __m128i lut_roll,
+        const __m128i special, __m128i& error)
+    {
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+        const __m128i hi_nibbles =
+            _mm_and_si128(_mm_srli_epi32(in, 4), nibble_mask);
+        const __m128i lo_nibbles = _mm_and_si128(in, nibble_mask);
+
+        const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+        error = _mm_or_si128(error, _mm_and_si128(lo, hi));
+
+        const __m128i is_special = _mm_and_si128(
+            _mm_cmpeq_epi8(in, special), _mm_set1_epi8(0x08));
+        const __m128i roll = _mm_shuffle_epi8(
+            lut_roll, _mm_or_si128(hi_nibbles, is_special));
+
+        return _mm_add_epi8(in, roll);
+    }
+
+    /// Pack 16 6-bit values into 12 bytes (lanes 12 ~ 15 are zeroed).
+    BASEXX_TARGET_SSE41
+    inline __m128i decode_pack_ssse3(const __m128i values)
+    {
+        const __m128i merged =
+            _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        const __m128i packed =
+            _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+
+        return _mm_shuffle_epi8(packed, _mm_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline void decode_store_12(char* dst, const __m128i out)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), out);
+        const int32_t tail = _mm_cvtsi128_si32(_mm_srli_si128(out, 8));
+        memcpy(dst + 8, &tail, 4);
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t decode_ssse3(const char* src,
+        const size_t src_len, char* dst, const DecodeLut& lut)
+    {
+        const __m128i lut_lo =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.lo));
+        const __m128i lut_hi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.hi));
+        const __m128i lut_roll =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.roll));
+        const __m128i special = _mm_set1_epi8(lut.special);
+        const __m128i zero = _mm_setzero_si128();
+
+        // A block is stored only once it is known to be valid (see
+        // decode_groups()).
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m128i error = zero;
+            const __m128i v0 = decode_translate_ssse3(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m128i v1 = decode_translate_ssse3(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos + 16)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m128i v2 = decode_translate_ssse3(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos + 32)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m128i v3 = decode_translate_ssse3(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos + 48)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+            {
+                break;
+            }
+
+            decode_store_12(dst + pos / 4 * 3, decode_pack_ssse3(v0));
+            decode_store_12(dst + pos / 4 * 3 + 12, decode_pack_ssse3(v1));
+            decode_store_12(dst + pos / 4 * 3 + 24, decode_pack_ssse3(v2));
+            decode_store_12(dst + pos / 4 * 3 + 36, decode_pack_ssse3(v3));
+        }
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i error = zero;
+            const __m128i values = decode_translate_ssse3(_mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF)
+            {
+                break;
+            }
+
+            decode_store_12(dst + pos / 4 * 3, decode_pack_ssse3(values));
+        }
+
+        return pos;
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    BASEXX_TARGET_AVX2
+    inline __m256i decode_translate_avx2(const __m256i in,
+        const __m256i lut_lo, const __m256i lut_hi, const __m256i lut_roll,
+        const __m256i special, __m256i& error)
+    {
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+        const __m256i hi_nibbles =
+            _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble_mask);
+        const __m256i lo_nibbles = _mm256_and_si256(in, nibble_mask);
+
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        error = _mm256_or_si256(error, _mm256_and_si256(lo, hi));
+
+        const __m256i is_special = _mm256_and_si256(
+            _mm256_cmpeq_epi8(in, special), _mm256_set1_epi8(0x08));
+        const __m256i roll = _mm256_shuffle_epi8(
+            lut_roll, _mm256_or_si256(hi_nibbles, is_special));
+
+        return _mm256_add_epi8(in, roll);
+    }
+
+    /// Pack 32 6-bit values into 24 bytes and store exactly those 24 bytes.
+    BASEXX_TARGET_AVX2
+    inline void decode_pack_store_avx2(char* dst, const __m256i values)
+    {
+        const __m256i merged =
+            _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+        __m256i packed =
+            _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+        packed = _mm256_shuffle_epi8(packed, _mm256_setr_epi8(
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+            2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        packed = _mm256_permutevar8x32_epi32(
+            packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+            _mm256_castsi256_si128(packed));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 16),
+            _mm256_extracti128_si256(packed, 1));
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_avx2(const char* src,
+        const size_t src_len, char* dst, const DecodeLut& lut)
+    {
+        const __m256i lut_lo = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.lo)));
+        const __m256i lut_hi = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.hi)));
+        const __m256i lut_roll = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.roll)));
+        const __m256i special = _mm256_set1_epi8(lut.special);
+
+        // Same store-after-check contract as decode_ssse3().
+        size_t pos = 0;
+        for (; pos + 128 <= src_len; pos += 128)
+        {
+            __m256i error = _mm256_setzero_si256();
+            const __m256i v0 = decode_translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m256i v1 = decode_translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos + 32)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m256i v2 = decode_translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos + 64)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            const __m256i v3 = decode_translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos + 96)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            if (!_mm256_testz_si256(error, error))
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 4 * 3, v0);
+            decode_pack_store_avx2(dst + pos / 4 * 3 + 24, v1);
+            decode_pack_store_avx2(dst + pos / 4 * 3 + 48, v2);
+            decode_pack_store_avx2(dst + pos / 4 * 3 + 72, v3);
+        }
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            __m256i error = _mm256_setzero_si256();
+            const __m256i values = decode_translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos)),
+                lut_lo, lut_hi, lut_roll, special, error);
+            if (!_mm256_testz_si256(error, error))
+            {
+                return pos;
+            }
+
+            decode_pack_store_avx2(dst + pos / 4 * 3, values);
+        }
+
+        return pos + decode_ssse3(
+            src + pos, src_len - pos, dst + pos / 4 * 3, lut);
+    }
+
+    /// Validation kernels: the classification of the decode kernels alone,
+    /// returning the number of characters in front of the first block that
+    /// holds one outside the alphabet.
+    BASEXX_TARGET_SSE41
+    inline __m128i validate_block_ssse3(const char* src,
+        const __m128i lut_lo, const __m128i lut_hi)
+    {
+        const __m128i in =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+        const __m128i hi_nibbles =
+            _mm_and_si128(_mm_srli_epi32(in, 4), nibble_mask);
+        const __m128i lo_nibbles = _mm_and_si128(in, nibble_mask);
+
+        return _mm_and_si128(_mm_shuffle_epi8(lut_lo, lo_nibbles),
+            _mm_shuffle_epi8(lut_hi, hi_nibbles));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t validate_ssse3(const char* src,
+        const size_t src_len, const DecodeLut& lut)
+    {
+        const __m128i lut_lo =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.lo));
+        const __m128i lut_hi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.hi));
+
+        size_t pos = 0;
+        while (src_len - pos >= 16)
+        {
+            const size_t blocks = (src_len - pos >= 64) ? 4 : 1;
+
+            __m128i error = _mm_setzero_si128();
+            for (size_t k = 0; k < blocks; k++)
+            {
+                error = _mm_or_si128(error, validate_block_ssse3(
+                    src + pos + k * 16, lut_lo, lut_hi));
+            }
+            if (!_mm_testz_si128(error, error))
+            {
+                break;
+            }
+
+            pos += blocks * 16;
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t validate_avx2(const char* src,
+        const size_t src_len, const DecodeLut& lut)
+    {
+        const __m256i lut_lo = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.lo)));
+        const __m256i lut_hi = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lut.hi)));
+        const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+
+        size_t pos = 0;
+        while (src_len - pos >= 32)
+        {
+            const size_t blocks = (src_len - pos >= 128) ? 4 : 1;
+
+            __m256i error = _mm256_setzero_si256();
+            for (size_t k = 0; k < blocks; k++)
+            {
+                const __m256i in = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src + pos + k * 32));
+                const __m256i hi_nibbles =
+                    _mm256_and_si256(_mm256_srli_epi32(in, 4), nibble_mask);
+                const __m256i lo_nibbles = _mm256_and_si256(in, nibble_mask);
+                error = _mm256_or_si256(error, _mm256_and_si256(
+                    _mm256_shuffle_epi8(lut_lo, lo_nibbles),
+                    _mm256_shuffle_epi8(lut_hi, hi_nibbles)));
+            }
+            if (!_mm256_testz_si256(error, error))
+            {
+                return pos;
+            }
+
+            pos += blocks * 32;
+        }
+
+        return pos + validate_ssse3(src + pos, src_len - pos, lut);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    /// Kernels of the alphabets chosen at run time (see CustomAlphabet).
+    /// Encoding looks the 6-bit indices up in the four 16-entry quarters of
+    /// the table, stored as the rows of a NibbleLut are; decoding packs the
+    /// values of translate_ssse3() & translate_avx2().
+    BASEXX_TARGET_SSE41
+    inline void encode_quarters_ssse3(const uint8_t* table, __m128i q[4])
+    {
+        __m128i prev = _mm_setzero_si128();
+        for (size_t k = 0; k < 4; k++)
+        {
+            const __m128i quarter = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(table + 16 * k));
+            q[k] = _mm_xor_si128(quarter, prev);
+            prev = quarter;
+        }
+    }
+
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_custom_translate_ssse3(
+        const __m128i indices, const __m128i q[4])
+    {
+        __m128i out = _mm_shuffle_epi8(q[0], indices);
+        out = _mm_xor_si128(out, _mm_shuffle_epi8(
+            q[1], _mm_sub_epi8(indices, _mm_set1_epi8(16))));
+        out = _mm_xor_si128(out, _mm_shuffle_epi8(
+            q[2], _mm_sub_epi8(indices, _mm_set1_epi8(32))));
+
+        return _mm_xor_si128(out, _mm_shuffle_epi8(
+            q[3], _mm_sub_epi8(indices, _mm_set1_epi8(48))));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t encode_custom_ssse3(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        __m128i q[4];
+        encode_quarters_ssse3(table, q);
+
+        size_t pos = 0;
+        while (src_len - pos >= 16)  // 12 bytes used, 4 bytes read-ahead
+        {
+            const __m128i in = _mm_loadu_si128(
+                reinterpret_cast<const __m128i*>(src + pos));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                encode_custom_translate_ssse3(encode_reshuffle_ssse3(in), q));
+
+            pos += 12;
+            dst += 16;
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t decode_custom_ssse3(const char* src,
+        const size_t src_len, char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m128i values[4];
+            __m128i error = _mm_setzero_si128();
+            translate_x4_ssse3(src + pos, lut, values, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_store_12(dst + pos / 4 * 3,
+                decode_pack_ssse3(values[0]));
+            decode_store_12(dst + pos / 4 * 3 + 12,
+                decode_pack_ssse3(values[1]));
+            decode_store_12(dst + pos / 4 * 3 + 24,
+                decode_pack_ssse3(values[2]));
+            decode_store_12(dst + pos / 4 * 3 + 36,
+                decode_pack_ssse3(values[3]));
+        }
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i error = _mm_setzero_si128();
+            const __m128i values = translate_ssse3(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                lut, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_store_12(dst + pos / 4 * 3, decode_pack_ssse3(values));
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t encode_custom_avx2(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        __m128i q[4];
+        encode_quarters_ssse3(table, q);
+        const __m256i q0 = _mm256_broadcastsi128_si256(q[0]);
+        const __m256i q1 = _mm256_broadcastsi128_si256(q[1]);
+        const __m256i q2 = _mm256_broadcastsi128_si256(q[2]);
+        const __m256i q3 = _mm256_broadcastsi128_si256(q[3]);
+
+        size_t pos = 0;
+        while (src_len - pos >= 28)  // 24 bytes -> 32 chars
+        {
+            const __m256i indices =
+                encode_reshuffle_avx2(encode_load_avx2(src + pos));
+            __m256i out = _mm256_shuffle_epi8(q0, indices);
+            out = _mm256_xor_si256(out, _mm256_shuffle_epi8(
+                q1, _mm256_sub_epi8(indices, _mm256_set1_epi8(16))));
+            out = _mm256_xor_si256(out, _mm256_shuffle_epi8(
+                q2, _mm256_sub_epi8(indices, _mm256_set1_epi8(32))));
+            out = _mm256_xor_si256(out, _mm256_shuffle_epi8(
+                q3, _mm256_sub_epi8(indices, _mm256_set1_epi8(48))));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), out);
+
+            pos += 24;
+            dst += 32;
+        }
+
+        return pos + encode_custom_ssse3(src + pos, src_len - pos, dst, table);
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_custom_avx2(const char* src,
+        const size_t src_len, char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 128 <= src_len; pos += 128)
+        {
+            __m256i values[4];
+            __m256i error = _mm256_setzero_si256();
+            translate_x4_avx2(src + pos, lut, values, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(
+                dst + pos / 4 * 3, values[0]);
+            decode_pack_store_avx2(
+                dst + pos / 4 * 3 + 24, values[1]);
+            decode_pack_store_avx2(
+                dst + pos / 4 * 3 + 48, values[2]);
+            decode_pack_store_avx2(
+                dst + pos / 4 * 3 + 72, values[3]);
+        }
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            __m256i error = _mm256_setzero_si256();
+            const __m256i values = translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos)), lut, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 4 * 3, values);
+        }
+
+        return pos + decode_custom_ssse3(
+            src + pos, src_len - pos, dst + pos / 4 * 3, lut);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+    /// SWAR kernels of the scalar level: one 64-bit load covers two 3-byte
+    /// groups (8 characters per store), unrolled over 24-byte blocks.
+    inline void encode_word_swar(
+        const uint8_t* src, char* dst, const uint8_t* table)
+    {
+        const uint64_t bits = load_be64(src);
+        store_le64(dst,
+            static_cast<uint64_t>(table[(bits >> 58) & 0x3F]) |
+            static_cast<uint64_t>(table[(bits >> 52) & 0x3F]) << 8 |
+            static_cast<uint64_t>(table[(bits >> 46) & 0x3F]) << 16 |
+            static_cast<uint64_t>(table[(bits >> 40) & 0x3F]) << 24 |
+            static_cast<uint64_t>(table[(bits >> 34) & 0x3F]) << 32 |
+            static_cast<uint64_t>(table[(bits >> 28) & 0x3F]) << 40 |
+            static_cast<uint64_t>(table[(bits >> 22) & 0x3F]) << 48 |
+            static_cast<uint64_t>(table[(bits >> 16) & 0x3F]) << 56);
+    }
+
+    inline size_t encode_scalar(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        // Every load reads 8 bytes to use 6 of them
+        size_t pos = 0;
+        for (; pos + 26 <= src_len; pos += 24, dst += 32)
+        {
+            encode_word_swar(src + pos, dst, table);
+            encode_word_swar(src + pos + 6, dst + 8, table);
+            encode_word_swar(src + pos + 12, dst + 16, table);
+            encode_word_swar(src + pos + 18, dst + 24, table);
+        }
+        for (; pos + 8 <= src_len; pos += 6, dst += 8)
+        {
+            encode_word_swar(src + pos, dst, table);
+        }
+
+        return pos;
+    }
+
+    /// Same as encode_lines_ssse3() a word at a time, for any line length
+    /// and table. Reads 2 bytes past the last line.
+    inline void encode_lines_scalar(const uint8_t* src, size_t lines,
+        const size_t line_len, const char* line_end, const size_t end_len,
+        char* dst, const uint8_t* table)
+    {
+        const size_t line_bytes = line_len / 4 * 3;
+
+        for (; lines != 0; lines--)
+        {
+            if (line_len < 8)  // a single quartet
+            {
+                dst[0] = table[src[0] >> 2];
+                dst[1] = table[((src[0] & 0x03) << 4) | (src[1] >> 4)];
+                dst[2] = table[((src[1] & 0x0F) << 2) | (src[2] >> 6)];
+                dst[3] = table[src[2] & 0x3F];
+            }
+            else
+            {
+                for (size_t out = 0; out < line_len; out += 8)
+                {
+                    const size_t at =
+                        (out + 8 <= line_len) ? out : line_len - 8;
+                    encode_word_swar(src + at / 4 * 3, dst + at, table);
+                }
+            }
+
+            src += line_bytes;
+            dst += line_len;
+            for (size_t i = 0; i < end_len; i++)
+            {
+                *dst++ = line_end[i];
+            }
+        }
+    }
+
+    /// Decode two quartets into 6 bytes; false (nothing written) when one of
+    /// the 8 characters is outside the alphabet.
+    inline bool decode_word_swar(
+        const char* src, char* dst, const DecodeTable& table)
+    {
+        const uint64_t v0 = table(src[0]);
+        const uint64_t v1 = table(src[1]);
+        const uint64_t v2 = table(src[2]);
+        const uint64_t v3 = table(src[3]);
+        const uint64_t v4 = table(src[4]);
+        const uint64_t v5 = table(src[5]);
+        const uint64_t v6 = table(src[6]);
+        const uint64_t v7 = table(src[7]);
+        if ((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) & 0x80)
+        {
+            return false;
+        }
+
+        const uint64_t bits =
+            v0 << 42 | v1 << 36 | v2 << 30 | v3 << 24 |
+            v4 << 18 | v5 << 12 | v6 << 6 | v7;
+
+        store_be<6>(dst, bits);
+        return true;
+    }
+
+    inline size_t decode_table_scalar(const char* src, const size_t src_len,
+        char* dst, const DecodeTable& table)
+    {
+        size_t pos = 0;
+        for (; pos + 32 <= src_len; pos += 32, dst += 24)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                return pos;
+            }
+            if (!decode_word_swar(src + pos + 8, dst + 6, table))
+            {
+                return pos + 8;
+            }
+            if (!decode_word_swar(src + pos + 16, dst + 12, table))
+            {
+                return pos + 16;
+            }
+            if (!decode_word_swar(src + pos + 24, dst + 18, table))
+            {
+                return pos + 24;
+            }
+        }
+        for (; pos + 8 <= src_len; pos += 8, dst += 6)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    inline size_t decode_scalar(const char* src, const size_t src_len,
+        char* dst, const DecodeLut& lut)
+    {
+        return decode_table_scalar(src, src_len, dst, lut.table);
+    }
+
+    inline size_t decode_custom_scalar(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        return decode_table_scalar(src, src_len, dst, lut.table);
+    }
+
+    inline size_t validate_scalar(const char* src, const size_t src_len,
+        const DecodeLut& lut)
+    {
+        return validate_table_scalar(src, src_len, lut.table);
+    }
+
+    /// Bulk kernels bound to each eSimdLevel.
+    struct Kernels
+    {
+        size_t (*encode)(const uint8_t* src, const size_t src_len,
+            char* dst, const uint8_t* table);
+        size_t (*decode)(const char* src, const size_t src_len,
+            char* dst, const DecodeLut& lut);
+        void (*encode_lines)(const uint8_t* src, size_t lines,
+            const size_t line_len, const char* line_end, const size_t end_len,
+            char* dst, const uint8_t* table);
+        size_t (*validate)(const char* src, const size_t src_len,
+            const DecodeLut& lut);
+        size_t (*encode_custom)(const uint8_t* src, const size_t src_len,
+            char* dst, const uint8_t* table);
+        size_t (*decode_custom)(const char* src, const size_t src_len,
+            char* dst, const NibbleLut& lut);
+    };
+
+    inline const Kernels& kernels()
+    {
+        static const Kernels table[] = {
+            // eSimdLevel::Scalar
+            { &encode_scalar, &decode_scalar, &encode_lines_scalar,
+                &validate_scalar, &encode_scalar, &decode_custom_scalar },
+#if defined(BASEXX_X86_SIMD)
+            // eSimdLevel::SSE41
+            { &encode_ssse3, &decode_ssse3, &encode_lines_ssse3,
+                &validate_ssse3, &encode_custom_ssse3, &decode_custom_ssse3 },
+            // eSimdLevel::AVX2
+            { &encode_avx2, &decode_avx2, &encode_lines_avx2,
+                &validate_avx2, &encode_custom_avx2, &decode_custom_avx2 },
+            // eSimdLevel::AVX512BW
+            { &encode_avx2, &decode_avx2, &encode_lines_avx2,
+                &validate_avx2, &encode_custom_avx2, &decode_custom_avx2 },
+#endif  // defined(BASEXX_X86_SIMD)
+        };
+
+        return table[static_cast<size_t>(simd_level())];
+    }
+
+    /// Whether the offset translation of the encode kernels fits `table`:
+    /// it takes the last two characters from the table and needs the
+    /// A ~ Z, a ~ z, 0 ~ 9 of RFC 4648 in front of them. Compared by
+    /// content, as the tables of two translation units are distinct objects.
+    inline bool offset_table(const uint8_t* table)
+    {
+        return memcmp(table, encoding_table, 62) == 0;
+    }
+
+    /// Encode as many whole groups as the active kernel can take; a table
+    /// the offset translation does not fit goes through the quarter lookups
+    /// of encode_custom.
+    inline size_t encode_simd(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        if (!offset_table(table))
+        {
+            return kernels().encode_custom(src, src_len, dst, table);
+        }
+
+        return kernels().encode(src, src_len, dst, table);
+    }
+
+    /// Encode whole groups a kernel at a time: the active level first, the
+    /// SWAR words of the scalar level after it. Returns the bytes consumed.
+    inline size_t encode_words(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        const size_t pos = encode_simd(src, src_len, dst, table);
+
+        return pos + encode_scalar(
+            src + pos, src_len - pos, dst + pos / 3 * 4, table);
+    }
+
+    /// SIMD plug-in of the Codec engine (see ScalarPlugin) for the alphabet
+    /// policies below, which derive from it.
+    template <typename Alphabet>
+    struct SimdPlugin
+    {
+        static size_t encode_bulk(
+            const uint8_t* src, const size_t src_len, char* dst)
+        {
+            return encode_words(src, src_len, dst, Alphabet::encoding());
+        }
+
+        static size_t decode_bulk(
+            const char* src, const size_t src_len, char* dst)
+        {
+            return kernels().decode(src, src_len, dst, *Alphabet::lut());
+        }
+
+        static size_t validate_bulk(const char* src, const size_t src_len)
+        {
+            return kernels().validate(src, src_len, *Alphabet::lut());
+        }
+    };
+
+    /// Alphabet policies of the encode/decode templates. Both tables are
+    /// compile-time constants, so the scalar loops index them directly.
+    struct StandardAlphabet : SimdPlugin<StandardAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return decode_table;
+        }
+
+        static constexpr const DecodeLut* lut()
+        {
+            return &decode_lut;
+        }
+    };
+
+    struct UrlSafeAlphabet : SimdPlugin<UrlSafeAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return urlsafe_encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return urlsafe_decode_table;
+        }
+
+        static constexpr const DecodeLut* lut()
+        {
+            return &urlsafe_decode_lut;
+        }
+    };
+
+    /// Alphabets of the overloads taking an encoding table or a character
+    /// lookup chosen at run time, all of them forwarded to RuntimeCodec. The
+    /// built-in lookups (decode_char and urlsafe_decode_char included) keep
+    /// the kernels of their policies, any other goes through the scalar
+    /// loops.
+    inline RuntimeAlphabet runtime_alphabet(const uint8_t* table)
+    {
+        return RuntimeAlphabet::encoder(table, &encode_words);
+    }
+
+    inline RuntimeAlphabet runtime_alphabet(
+        uint8_t (*value_func)(const char))
+    {
+        if (value_func == &decode_value || value_func == &decode_char)
+        {
+            return RuntimeAlphabet::decoder<StandardAlphabet>();
+        }
+        else if (value_func == &urlsafe_decode_value ||
+                 value_func == &urlsafe_decode_char)
+        {
+            return RuntimeAlphabet::decoder<UrlSafeAlphabet>();
+        }
+
+        return RuntimeAlphabet::decoder(value_func);
+    }
+
+    using RuntimeCodec = Codec<RuntimeAlphabet, 6>;
+
+
+    /// ========================================================================
+    /// Encoding & Decoding
+    /// ------------------------------------------------------------------------
+    /// The functions of Codec (see there) with the defaults of RFC 4648: the
+    /// templates take an alphabet policy, the other overloads an encoding
+    /// table or a character lookup. `value_func` maps a character to its
+    /// value or invalid_value; in the parallel functions it is called from
+    /// several threads and must not throw.
+    /// ========================================================================
+
+    inline size_t encode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(table));
+    }
+
+    inline std::string encode_base(const char* data,
+        const size_t data_len, const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode(
+            data, data_len, padding, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet>
+    inline std::string encode_base(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 6>::encode(data, data_len, padding);
+    }
+
+    template <typename Alphabet>
+    inline DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 6>::try_decode_into(
+            dst, dst_cap, data, data_len, padding);
+    }
+
+    inline DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::try_decode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(value_func));
+    }
+
+    template <typename Alphabet>
+    inline size_t decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 6>::decode_into(
+            dst, dst_cap, data, data_len, padding);
+    }
+
+    inline size_t decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode(const char* data, const size_t data_len,
+        Output& out, uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::try_decode(
+            data, data_len, out, padding, runtime_alphabet(value_func));
+    }
+
+    inline std::string decode_base(const char* data,
+        const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode(
+            data, data_len, padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Alphabet>
+    inline std::string decode_base(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 6>::decode(data, data_len, padding);
+    }
+
+    template <typename Output>
+    inline void encode_append(Output& out,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        RuntimeCodec::encode_append(
+            out, data, data_len, padding, runtime_alphabet(table));
+    }
+
+    template <typename Output>
+    inline void decode_append(Output& out,
+        const char* data, const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        RuntimeCodec::decode_append(out, data, data_len,
+            padding, runtime_alphabet(decode_char_func));
+    }
+
+    inline size_t encode_inplace(char* buf, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode_inplace(
+            buf, data_len, padding, runtime_alphabet(table));
+    }
+
+    inline size_t decode_inplace(char* buf, const size_t text_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode_inplace(
+            buf, text_len, padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Alphabet>
+    inline DecodeResult validate(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 6>::validate(data, data_len, padding);
+    }
+
+    inline DecodeResult validate(const char* data, const size_t data_len,
+        uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::validate(
+            data, data_len, padding, runtime_alphabet(value_func));
+    }
+
+
+    /// ========================================================================
+    /// Line Wrapping
+    /// ------------------------------------------------------------------------
+    /// MIME (RFC 2045: 76 characters, CRLF) and PEM (RFC 7468: 64
+    /// characters, LF) layouts written in the same pass as the encoding:
+    /// every full line is encoded by the active kernel straight to its place
+    /// in the output, followed by its line break.
+    /// ========================================================================
+
+    struct LineWrap
+    {
+        size_t line_len;     // characters per line, a multiple of 4 (0: none)
+        const char* line_end;
+        bool end_last_line;  // also terminate the last line
+    };
+
+    static constexpr LineWrap mime_wrap = { 76, "\r\n", false };
+    static constexpr LineWrap pem_wrap = { 64, "\n", true };
+
+    /// Exact length of the wrapped encoding of `data_len` bytes.
+    inline size_t wrapped_length(const size_t data_len, const LineWrap& wrap)
+    {
+        const size_t encoded_len = encoded_length(data_len);
+        if (encoded_len == 0 || wrap.line_len == 0)
+        {
+            return encoded_len;
+        }
+
+        const size_t lines = (encoded_len + wrap.line_len - 1) / wrap.line_len;
+        const size_t breaks = lines - ((wrap.end_last_line) ? 0 : 1);
+
+        return encoded_len + breaks * std::strlen(wrap.line_end);
+    }
+
+    /// Encode with line breaks into caller memory; returns the number of
+    /// characters written, always wrapped_length(data_len, wrap).
+    inline size_t encode_wrapped_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const LineWrap& wrap = mime_wrap,
+        const uint8_t* table = encoding_table)
+    {
+        if (wrap.line_len % 4 != 0)
+        {
+            throwRuntimeError(eResultCode::InvalidLength, __FUNCTION__,
+                "Line length must be a multiple of 4.");
+        }
+
+        const size_t wrapped_len = wrapped_length(data_len, wrap);
+        if (dst_cap < wrapped_len)
+        {
+            throwRuntimeError(eResultCode::InvalidBufferSize, __FUNCTION__);
+        }
+
+        if (wrap.line_len == 0)
+        {
+            return encode_into(dst, dst_cap, data, data_len, table);
+        }
+
+        const size_t line_bytes = wrap.line_len / 4 * 3;
+        const size_t end_len = std::strlen(wrap.line_end);
+
+        // Every line but the last is full and gets a line break. The line
+        // kernels read up to 4 bytes past their last line.
+        size_t lines = (data_len != 0) ? (data_len - 1) / line_bytes : 0;
+        if (lines != 0 && data_len - lines * line_bytes < 4)
+        {
+            lines--;
+        }
+
+        const auto encode_lines =
+            (offset_table(table) && wrap.line_len >= 16)
+            ? kernels().encode_lines
+            : &encode_lines_scalar;
+        encode_lines(reinterpret_cast<const uint8_t*>(data), lines,
+            wrap.line_len, wrap.line_end, end_len, dst, table);
+
+        char* out = dst + lines * (wrap.line_len + end_len);
+        size_t pos = lines * line_bytes;
+        for (; data_len - pos > line_bytes; pos += line_bytes)
+        {
+            out += encode_into(out, wrapped_len - (out - dst),
+                data + pos, line_bytes, table);
+            memcpy(out, wrap.line_end, end_len);
+            out += end_len;
+        }
+
+        out += encode_into(out, wrapped_len - (out - dst),
+            data + pos, data_len - pos, table);
+        if (wrap.end_last_line && data_len != 0)
+        {
+            memcpy(out, wrap.line_end, end_len);
+            out += end_len;
+        }
+
+        return out - dst;
+    }
+
+    template <typename Output>
+    inline void encode_wrapped_append(Output& out,
+        const char* data, const size_t data_len,
+        const LineWrap& wrap = mime_wrap,
+        const uint8_t* table = encoding_table)
+    {
+        const size_t old_len = out.size();
+        out.resize(old_len + wrapped_length(data_len, wrap));
+        encode_wrapped_into(output_data(out, old_len), out.size() - old_len,
+            data, data_len, wrap, table);
+    }
+
+
+    /// ========================================================================
+    /// Lenient, Parallel & Columnar Coding
+    /// ------------------------------------------------------------------------
+    /// Forwards to RuntimeCodec, as above.
+    /// ========================================================================
+
+    inline DecodeResult try_decode_lenient_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const eLenience lenience = eLenience::Whitespace,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_lenient_into(dst, dst_cap,
+            data, data_len, lenience, runtime_alphabet(value_func));
+    }
+
+    inline size_t decode_lenient_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const eLenience lenience = eLenience::Whitespace,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::decode_lenient_into(dst, dst_cap,
+            data, data_len, lenience, runtime_alphabet(value_func));
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_lenient(
+        const char* data, const size_t data_len, Output& out,
+        const eLenience lenience = eLenience::Whitespace,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_lenient(
+            data, data_len, out, lenience, runtime_alphabet(value_func));
+    }
+
+    template <typename Output>
+    inline void decode_lenient_append(Output& out,
+        const char* data, const size_t data_len,
+        const eLenience lenience = eLenience::Whitespace,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        RuntimeCodec::decode_lenient_append(
+            out, data, data_len, lenience, runtime_alphabet(value_func));
+    }
+
+    inline size_t encode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    inline std::string encode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel(
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    inline DecodeResult try_decode_parallel_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const size_t threads = 0,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(value_func));
+    }
+
+    inline size_t decode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(decode_char_func));
+    }
+
+    inline std::string decode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_parallel(
+            data, data_len, threads, runtime_alphabet(decode_char_func));
+    }
+
+    inline size_t encoded_batch_length(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::encoded_batch_length(offsets, rows);
+    }
+
+    constexpr size_t decoded_batch_capacity(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::decoded_batch_capacity(offsets, rows);
+    }
+
+    inline size_t encode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch_into(dst, dst_cap, dst_offsets,
+            data, offsets, rows, runtime_alphabet(table));
+    }
+
+    inline void encode_batch(const Column& column, Column& out,
+        const uint8_t* table = encoding_table)
+    {
+        RuntimeCodec::encode_batch(column, out, runtime_alphabet(table));
+    }
+
+    inline Column encode_batch(
+        const Column& column, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch(column, runtime_alphabet(table));
+    }
+
+    inline size_t try_decode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, DecodeResult* results = nullptr,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_batch_into(dst, dst_cap, dst_offsets,
+            data, offsets, rows, results, runtime_alphabet(value_func));
+    }
+
+    inline size_t try_decode_batch(const Column& column, Column& out,
+        std::vector<RowError>& errors,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_batch(
+            column, out, errors, runtime_alphabet(value_func));
+    }
+
+    inline Column decode_batch(const Column& column,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_batch(
+            column, runtime_alphabet(decode_char_func));
+    }
+
+    /// Streaming encoder of any encoding table (see Codec::Encoder).
+    class Encoder : public RuntimeCodec::Encoder
+    {
+    public:
+        explicit Encoder(const uint8_t* table = encoding_table)
+            : RuntimeCodec::Encoder(runtime_alphabet(table))
+        {
+        }
+    };
+
+    /// Streaming decoder of any encoding table (see Codec::Decoder).
+    class Decoder : public RuntimeCodec::Decoder
+    {
+    public:
+        explicit Decoder(const uint8_t* table = encoding_table)
+            : RuntimeCodec::Decoder(
+                kernels_of(table), make_decode_table(table, 64))
+        {
+        }
+
+    private:
+        /// The kernels of the built-in alphabet `table` holds, if any; the
+        /// decoder looks characters up in its own table.
+        static RuntimeAlphabet kernels_of(const uint8_t* table)
+        {
+            return (memcmp(table, encoding_table, 64) == 0)
+                ? RuntimeAlphabet::decoder<StandardAlphabet>()
+                : (memcmp(table, urlsafe_encoding_table, 64) == 0)
+                    ? RuntimeAlphabet::decoder<UrlSafeAlphabet>()
+                    : RuntimeAlphabet::decoder(nullptr);
+        }
+    };
+
+
+    /// ========================================================================
+    /// Helper Functions
+    /// ========================================================================
+
+    inline size_t encode_urlsafe_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return encode_into(
+            dst, dst_cap, data, data_len, urlsafe_encoding_table, padding);
+    }
+
+    inline size_t decode_urlsafe_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return decode_into(
+            dst, dst_cap, data, data_len, &urlsafe_decode_char, padding);
+    }
+
+    template <typename Output>
+    inline void encode_urlsafe_append(
+        Output& out, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        encode_append(out, data, data_len, urlsafe_encoding_table, padding);
+    }
+
+    template <typename Output>
+    inline void decode_urlsafe_append(
+        Output& out, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        decode_append(out, data, data_len, &urlsafe_decode_char, padding);
+    }
+
+    inline size_t encode_urlsafe_inplace(char* buf, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return encode_inplace(buf, data_len, urlsafe_encoding_table, padding);
+    }
+
+    inline size_t decode_urlsafe_inplace(char* buf, const size_t text_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return decode_inplace(buf, text_len, &urlsafe_decode_char, padding);
+    }
+
+    inline DecodeResult try_decode_urlsafe_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode_into(
+            dst, dst_cap, data, data_len, &urlsafe_decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_urlsafe(
+        const char* data, const size_t data_len, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(data, data_len, out, &urlsafe_decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode(const ByteView text, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(
+            text.data(), text.size(), out, &decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_urlsafe(const ByteView text, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(
+            text.data(), text.size(), out, &urlsafe_decode_value, padding);
+    }
+
+    /// Encode into a fixed-size contiguous container such as std::array;
+    /// returns the number of characters written.
+    template <typename Output>
+    inline size_t encode_into(Output& out, const ByteView bytes)
+    {
+        return encode_into(
+            output_data(out, 0), out.size(), bytes.data(), bytes.size());
+    }
+
+    /// Decode into a fixed-size contiguous container such as
+    /// std::array<uint8_t, N>; returns the number of bytes written.
+    template <typename Output>
+    inline size_t decode_into(Output& out, const ByteView text)
+    {
+        return decode_into(
+            output_data(out, 0), out.size(), text.data(), text.size());
+    }
+
+    inline std::string encode(const ByteView bytes = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base<StandardAlphabet>(
+                bytes.data(), bytes.size(), padding);
+    }
+
+    /// Without padding for tokens such as JWT segments, e.g.
+    /// encode_urlsafe(claims, ePadding::None).
+    inline std::string encode_urlsafe(const ByteView bytes = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base<UrlSafeAlphabet>(bytes.data(), bytes.size(), padding);
+    }
+
+    /// Encoding broken into lines, e.g. encode_wrapped(der, pem_wrap).
+    inline std::string encode_wrapped(
+        const ByteView bytes, const LineWrap& wrap = mime_wrap)
+    {
+        std::string encoded{};
+        encode_wrapped_append(encoded, bytes.data(), bytes.size(), wrap);
+
+        return encoded;
+    }
+
+    inline std::string decode(const ByteView text = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base<StandardAlphabet>(text.data(), text.size(), padding);
+    }
+
+    /// Unpadded text needs ePadding::Optional (or None, to reject '=').
+    inline std::string decode_urlsafe(const ByteView text = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base<UrlSafeAlphabet>(text.data(), text.size(), padding);
+    }
+
+    /// Decoding that skips whitespace, e.g. decode_lenient(pem_body) or
+    /// decode_lenient(text, eLenience::Forgiving).
+    inline std::string decode_lenient(const ByteView text,
+        const eLenience lenience = eLenience::Whitespace)
+    {
+        std::string decoded{};
+        decode_lenient_append(decoded, text.data(), text.size(), lenience);
+
+        return decoded;
+    }
+
+    /// Whether `text` decodes, checked without decoding it (see validate()).
+    inline bool is_valid(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return static_cast<bool>(validate<StandardAlphabet>(
+            text.data(), text.size(), padding));
+    }
+
+    inline bool is_valid_urlsafe(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return static_cast<bool>(validate<UrlSafeAlphabet>(
+            text.data(), text.size(), padding));
+    }
+
+    /// Decoded length of `text` in `written`, or its first error, without
+    /// decoding it; e.g. for size limits ahead of a decode.
+    inline DecodeResult decoded_size(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return validate<StandardAlphabet>(text.data(), text.size(), padding);
+    }
+
+    inline DecodeResult decoded_size_urlsafe(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return validate<UrlSafeAlphabet>(text.data(), text.size(), padding);
+    }
+
+    /// Result in an `Output` container built with `alloc`, e.g.
+    /// encode<std::pmr::string>(str, &arena) or
+    /// decode<std::vector<uint8_t, MyAllocator>>(str).
+    template <typename Output>
+    inline Output encode(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output encode_urlsafe(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_urlsafe_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode_urlsafe(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_urlsafe_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+
+    /// ========================================================================
+    /// Compile-time Literals
+    /// ========================================================================
+
+    /// Encoding of a string literal (without its terminating NUL) or of a
+    /// std::array of bytes, usable in constant expressions, e.g.
+    ///     constexpr auto magic = base64::encode_literal("user:pass");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N - 1)> encode_literal(
+        const char (&str)[N])
+    {
+        return encode_static<6, Alphabet, N - 1>(
+            str, std::make_index_sequence<encoded_length(N - 1)>{});
+    }
+
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N)> encode_literal(
+        const std::array<uint8_t, N>& bytes)
+    {
+        return encode_static<6, Alphabet, N>(
+            bytes, std::make_index_sequence<encoded_length(N)>{});
+    }
+
+    /// Decoding of a string literal, usable in constant expressions; a
+    /// malformed literal is a compile error there, e.g.
+    ///     constexpr auto key = base64::decode_literal("3q2+7w==");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr StaticBytes<(N - 1) / 4 * 3> decode_literal(
+        const char (&text)[N])
+    {
+        return decode_static<6, 4, Alphabet>(
+            text, N - 1, std::make_index_sequence<(N - 1) / 4 * 3>{});
+    }
+}  // namespace BaseXX::_64_
+
+namespace _32_
+{
+    /// ========================================================================
+    /// Base32[-Hex] Encoding/Decoding Implementation
+    /// ========================================================================
+
+    /// The Base 32 Alphabet Table
+    /// https://datatracker.ietf.org/doc/html/rfc4648#section-6
+    ///
+    static constexpr uint8_t encoding_table[32] = {
+        'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',  // 0 ~ 7
+        'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',  // 8 ~ 15
+        'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X',  // 16 ~ 23
+        'Y', 'Z', '2', '3', '4', '5', '6', '7',  // 24 ~ 31
+    };
+
+    /// The Base 32 Alphabet Table (Extended Hex)
+    /// https://datatracker.ietf.org/doc/html/rfc4648#section-7
+    ///
+    static constexpr uint8_t hex_encoding_table[32] = {
+        '0', '1', '2', '3', '4', '5', '6', '7',  // 0 ~ 7
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',  // 8 ~ 15
+        'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N',  // 16 ~ 23
+        'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V',  // 24 ~ 31
+    };
+
+    /// Reverse tables: character -> 5-bit value, invalid_value otherwise
+    static constexpr DecodeTable decode_table =
+        make_decode_table(encoding_table);
+    static constexpr DecodeTable hex_decode_table =
+        make_decode_table(hex_encoding_table);
+
+    /// Length of the encoding of `data_len` bytes, padded by default.
+    constexpr size_t encoded_length(const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Geometry<5>::encoded_length(data_len, padding);
+    }
+
+    /// Exact decoded length of an encoded text. Only the trailing padding is
+    /// inspected; the characters themselves are not validated.
+    constexpr size_t decoded_length(
+        const char* encoded_text, const size_t text_len)
+    {
+        return Geometry<5>::decoded_length(encoded_text, text_len);
+    }
+
+    /// Length & padding checks of a text to decode. Without padding the
+    /// last group may be short, but only 2, 4, 5 or 7 characters long, and
+    /// padding must complete such a group.
+    inline eResultCode check_format(
+        const char* encoded_text, const size_t text_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Geometry<5>::check_format(encoded_text, text_len, padding);
+    }
+
+    /// Value of a character, or invalid_value outside the alphabet.
+    constexpr uint8_t decode_value(const char c) noexcept
+    {
+        return decode_table(c);
+    }
+
+    inline uint8_t decode_char(const char c)
+    {
+        return decode_value_or_throw(decode_value, c, __FUNCTION__);
+    }
+
+    constexpr uint8_t hex_decode_value(const char c) noexcept
+    {
+        return hex_decode_table(c);
+    }
+
+    inline uint8_t hex_decode_char(const char c)
+    {
+        return decode_value_or_throw(hex_decode_value, c, __FUNCTION__);
+    }
+
+    /// ========================================================================
+    /// SIMD Kernels
+    /// ------------------------------------------------------------------------
+    /// Encode kernels take whole 5-byte groups and return the number of bytes
+    /// consumed; decode kernels take whole octets and return the number of
+    /// characters consumed, stopping in front of the first invalid block.
+    /// Encoding gathers the big-endian 16-bit word holding each 5-bit index,
+    /// shifts every lane by its own amount with a multiply-high and maps the
+    /// indices through two 16-entry shuffles. Decoding validates with range
+    /// compares and packs the values with two multiply-adds.
+    /// ========================================================================
+
+    /// The two ASCII ranges an alphabet is made of, in table order, and
+    /// the same alphabet as a table for the scalar kernels.
+    struct DecodeRanges
+    {
+        char first1;
+        char len1;
+        char first2;
+        char len2;
+        DecodeTable table;
+    };
+
+    static constexpr DecodeRanges decode_ranges =
+        { 'A', 26, '2', 6, decode_table };
+    static constexpr DecodeRanges hex_decode_ranges =
+        { '0', 10, 'A', 22, hex_decode_table };
+
+#if defined(BASEXX_X86_SIMD)
+    /// Indices of two 5-byte groups (the low 10 bytes of `in`).
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_split_sse41(const __m128i in)
+    {
+        // Word k of a group starts at byte j = 5 * k / 8 and is shifted
+        // right by 11 - 5 * k % 8 through the multiply-high below.
+        const __m128i group0 = _mm_shuffle_epi8(in, _mm_setr_epi8(
+            1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4));
+        const __m128i group1 = _mm_shuffle_epi8(in, _mm_setr_epi8(
+            6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9));
+        const __m128i multipliers =
+            _mm_setr_epi16(32, 1024, 128, 4096, 512, 64, 2048, 256);
+        const __m128i mask = _mm_set1_epi16(0x1F);
+
+        return _mm_packus_epi16(
+            _mm_and_si128(_mm_mulhi_epu16(group0, multipliers), mask),
+            _mm_and_si128(_mm_mulhi_epu16(group1, multipliers), mask));
+    }
+
+    /// Characters of 16 indices through a 32-entry table split in halves.
+    BASEXX_TARGET_SSE41
+    inline __m128i encode_translate_sse41(const __m128i indices,
+        const __m128i table_lo, const __m128i table_hi)
+    {
+        return _mm_blendv_epi8(_mm_shuffle_epi8(table_lo, indices),
+            _mm_shuffle_epi8(table_hi, indices),
+            _mm_cmpgt_epi8(indices, _mm_set1_epi8(15)));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t encode_sse41(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        const __m128i table_lo =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+        const __m128i table_hi =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16));
+
+        // 10 bytes per iteration, but the load reads 16
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 10)
+        {
+            const __m128i indices = encode_split_sse41(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + pos / 5 * 8),
+                encode_translate_sse41(indices, table_lo, table_hi));
+        }
+
+        return pos;
+    }
+
+    /// Values of 16 characters; `valid` gets 0xFF in every lane holding a
+    /// character of the alphabet.
+    BASEXX_TARGET_SSE41
+    inline __m128i decode_translate_sse41(const __m128i in,
+        const DecodeRanges& ranges, __m128i& valid)
+    {
+        const __m128i d1 = _mm_sub_epi8(in, _mm_set1_epi8(ranges.first1));
+        const __m128i d2 = _mm_sub_epi8(in, _mm_set1_epi8(ranges.first2));
+        const __m128i in1 = _mm_cmpeq_epi8(
+            _mm_min_epu8(d1, _mm_set1_epi8(ranges.len1 - 1)), d1);
+        const __m128i in2 = _mm_cmpeq_epi8(
+            _mm_min_epu8(d2, _mm_set1_epi8(ranges.len2 - 1)), d2);
+
+        valid = _mm_or_si128(in1, in2);
+        return _mm_or_si128(_mm_and_si128(in1, d1), _mm_and_si128(in2,
+            _mm_add_epi8(d2, _mm_set1_epi8(ranges.len1))));
+    }
+
+    /// Pack the 5-bit values of two octets into 10 bytes at the bottom of
+    /// the register.
+    BASEXX_TARGET_SSE41
+    inline __m128i decode_pack_sse41(const __m128i values)
+    {
+        // v0 * 32 + v1 -> 10 bits, then w0 * 1024 + w1 -> 20 bits
+        const __m128i words =
+            _mm_maddubs_epi16(values, _mm_set1_epi16(0x0120));
+        const __m128i halves =
+            _mm_madd_epi16(words, _mm_set1_epi32(0x00010400));
+
+        // Each 64-bit lane: first half << 20 | second half -> 40 bits
+        const __m128i bits = _mm_or_si128(
+            _mm_slli_epi64(_mm_and_si128(halves,
+                _mm_set1_epi64x(0xFFFFFFFF)), 20),
+            _mm_srli_epi64(halves, 32));
+
+        return _mm_shuffle_epi8(bits, _mm_setr_epi8(
+            4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline void decode_store_10(char* dst, const __m128i packed)
+    {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst), packed);
+        const uint16_t tail =
+            static_cast<uint16_t>(_mm_extract_epi16(packed, 4));
+        memcpy(dst + 8, &tail, 2);
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t decode_sse41(const char* src, const size_t src_len,
+        char* dst, const DecodeRanges& ranges)
+    {
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i valid;
+            const __m128i values = decode_translate_sse41(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                ranges, valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF)
+            {
+                break;
+            }
+
+            decode_store_10(dst + pos / 8 * 5, decode_pack_sse41(values));
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t encode_avx2(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        const __m256i table_lo = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+        const __m256i table_hi = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table + 16)));
+        const __m256i shuffle0 = _mm256_setr_epi8(
+            1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4,
+            1, 0, 1, 0, 2, 1, 2, 1, 3, 2, 4, 3, 4, 3, 5, 4);
+        const __m256i shuffle1 = _mm256_setr_epi8(
+            6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9,
+            6, 5, 6, 5, 7, 6, 7, 6, 8, 7, 9, 8, 9, 8, 10, 9);
+        const __m256i multipliers = _mm256_setr_epi16(
+            32, 1024, 128, 4096, 512, 64, 2048, 256,
+            32, 1024, 128, 4096, 512, 64, 2048, 256);
+        const __m256i mask = _mm256_set1_epi16(0x1F);
+
+        // 20 bytes per iteration, 10 in each 128-bit lane; the upper load
+        // reads 16 bytes from offset 10
+        size_t pos = 0;
+        for (; pos + 26 <= src_len; pos += 20)
+        {
+            const __m256i in = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(src + pos))),
+                _mm_loadu_si128(
+                    reinterpret_cast<const __m128i*>(src + pos + 10)), 1);
+
+            const __m256i indices = _mm256_packus_epi16(
+                _mm256_and_si256(_mm256_mulhi_epu16(
+                    _mm256_shuffle_epi8(in, shuffle0), multipliers), mask),
+                _mm256_and_si256(_mm256_mulhi_epu16(
+                    _mm256_shuffle_epi8(in, shuffle1), multipliers), mask));
+
+            const __m256i chars = _mm256_blendv_epi8(
+                _mm256_shuffle_epi8(table_lo, indices),
+                _mm256_shuffle_epi8(table_hi, indices),
+                _mm256_cmpgt_epi8(indices, _mm256_set1_epi8(15)));
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + pos / 5 * 8), chars);
+        }
+
+        return pos + encode_sse41(src + pos, src_len - pos,
+            dst + pos / 5 * 8, table);
+    }
+
+    /// Pack the 5-bit values of four octets and store exactly those 20
+    /// bytes.
+    BASEXX_TARGET_AVX2
+    inline void decode_pack_store_avx2(char* dst, const __m256i values)
+    {
+        const __m256i words =
+            _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0120));
+        const __m256i halves =
+            _mm256_madd_epi16(words, _mm256_set1_epi32(0x00010400));
+        const __m256i bits = _mm256_or_si256(
+            _mm256_slli_epi64(_mm256_and_si256(halves,
+                _mm256_set1_epi64x(0xFFFFFFFF)), 20),
+            _mm256_srli_epi64(halves, 32));
+        const __m256i packed = _mm256_shuffle_epi8(bits, _mm256_setr_epi8(
+            4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1,
+            4, 3, 2, 1, 0, 12, 11, 10, 9, 8, -1, -1, -1, -1, -1, -1));
+
+        decode_store_10(dst, _mm256_castsi256_si128(packed));
+        decode_store_10(dst + 10, _mm256_extracti128_si256(packed, 1));
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_avx2(const char* src, const size_t src_len,
+        char* dst, const DecodeRanges& ranges)
+    {
+        const __m256i first1 = _mm256_set1_epi8(ranges.first1);
+        const __m256i first2 = _mm256_set1_epi8(ranges.first2);
+        const __m256i last1 = _mm256_set1_epi8(ranges.len1 - 1);
+        const __m256i last2 = _mm256_set1_epi8(ranges.len2 - 1);
+        const __m256i len1 = _mm256_set1_epi8(ranges.len1);
+
+        size_t pos = 0;
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            const __m256i in = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos));
+            const __m256i d1 = _mm256_sub_epi8(in, first1);
+            const __m256i d2 = _mm256_sub_epi8(in, first2);
+            const __m256i in1 =
+                _mm256_cmpeq_epi8(_mm256_min_epu8(d1, last1), d1);
+            const __m256i in2 =
+                _mm256_cmpeq_epi8(_mm256_min_epu8(d2, last2), d2);
+            if (_mm256_movemask_epi8(_mm256_or_si256(in1, in2)) != -1)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 8 * 5, _mm256_or_si256(
+                _mm256_and_si256(in1, d1),
+                _mm256_and_si256(in2, _mm256_add_epi8(d2, len1))));
+        }
+
+        return pos + decode_sse41(src + pos, src_len - pos,
+            dst + pos / 8 * 5, ranges);
+    }
+
+    /// Validation kernels: the range compares of the decode kernels alone,
+    /// returning the number of characters in front of the first block that
+    /// holds one outside the alphabet.
+    BASEXX_TARGET_SSE41
+    inline size_t validate_sse41(const char* src, const size_t src_len,
+        const DecodeRanges& ranges)
+    {
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i valid;
+            decode_translate_sse41(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                ranges, valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF)
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t validate_avx2(const char* src, const size_t src_len,
+        const DecodeRanges& ranges)
+    {
+        const __m256i first1 = _mm256_set1_epi8(ranges.first1);
+        const __m256i first2 = _mm256_set1_epi8(ranges.first2);
+        const __m256i last1 = _mm256_set1_epi8(ranges.len1 - 1);
+        const __m256i last2 = _mm256_set1_epi8(ranges.len2 - 1);
+
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m256i valid = _mm256_set1_epi8(-1);
+            for (size_t k = 0; k < 64; k += 32)
+            {
+                const __m256i in = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src + pos + k));
+                const __m256i d1 = _mm256_sub_epi8(in, first1);
+                const __m256i d2 = _mm256_sub_epi8(in, first2);
+                valid = _mm256_and_si256(valid, _mm256_or_si256(
+                    _mm256_cmpeq_epi8(_mm256_min_epu8(d1, last1), d1),
+                    _mm256_cmpeq_epi8(_mm256_min_epu8(d2, last2), d2)));
+            }
+            if (_mm256_movemask_epi8(valid) != -1)
+            {
+                break;
+            }
+        }
+
+        return pos + validate_sse41(src + pos, src_len - pos, ranges);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    /// Decode kernels of the alphabets chosen at run time (see
+    /// CustomAlphabet): the values of translate_ssse3() & translate_avx2(),
+    /// packed as above. Any table can be encoded by the kernels above.
+    BASEXX_TARGET_SSE41
+    inline size_t decode_custom_sse41(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m128i values[4];
+            __m128i error = _mm_setzero_si128();
+            translate_x4_ssse3(src + pos, lut, values, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_store_10(dst + pos / 8 * 5,
+                decode_pack_sse41(values[0]));
+            decode_store_10(dst + pos / 8 * 5 + 10,
+                decode_pack_sse41(values[1]));
+            decode_store_10(dst + pos / 8 * 5 + 20,
+                decode_pack_sse41(values[2]));
+            decode_store_10(dst + pos / 8 * 5 + 30,
+                decode_pack_sse41(values[3]));
+        }
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i error = _mm_setzero_si128();
+            const __m128i values = translate_ssse3(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                lut, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_store_10(dst + pos / 8 * 5, decode_pack_sse41(values));
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_custom_avx2(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 128 <= src_len; pos += 128)
+        {
+            __m256i values[4];
+            __m256i error = _mm256_setzero_si256();
+            translate_x4_avx2(src + pos, lut, values, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(
+                dst + pos / 8 * 5, values[0]);
+            decode_pack_store_avx2(
+                dst + pos / 8 * 5 + 20, values[1]);
+            decode_pack_store_avx2(
+                dst + pos / 8 * 5 + 40, values[2]);
+            decode_pack_store_avx2(
+                dst + pos / 8 * 5 + 60, values[3]);
+        }
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            __m256i error = _mm256_setzero_si256();
+            const __m256i values = translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos)), lut, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 8 * 5, values);
+        }
+
+        return pos + decode_custom_sse41(
+            src + pos, src_len - pos, dst + pos / 8 * 5, lut);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+    /// SWAR kernels of the scalar level: one 64-bit load per 5-byte group
+    /// (8 characters per store), unrolled over 20-byte blocks.
+    inline void encode_word_swar(
+        const uint8_t* src, char* dst, const uint8_t* table)
+    {
+        const uint64_t bits = load_be64(src);
+        store_le64(dst,
+            static_cast<uint64_t>(table[(bits >> 59) & 0x1F]) |
+            static_cast<uint64_t>(table[(bits >> 54) & 0x1F]) << 8 |
+            static_cast<uint64_t>(table[(bits >> 49) & 0x1F]) << 16 |
+            static_cast<uint64_t>(table[(bits >> 44) & 0x1F]) << 24 |
+            static_cast<uint64_t>(table[(bits >> 39) & 0x1F]) << 32 |
+            static_cast<uint64_t>(table[(bits >> 34) & 0x1F]) << 40 |
+            static_cast<uint64_t>(table[(bits >> 29) & 0x1F]) << 48 |
+            static_cast<uint64_t>(table[(bits >> 24) & 0x1F]) << 56);
+    }
+
+    inline size_t encode_scalar(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        // Every load reads 8 bytes to use 5 of them
+        size_t pos = 0;
+        for (; pos + 23 <= src_len; pos += 20, dst += 32)
+        {
+            encode_word_swar(src + pos, dst, table);
+            encode_word_swar(src + pos + 5, dst + 8, table);
+            encode_word_swar(src + pos + 10, dst + 16, table);
+            encode_word_swar(src + pos + 15, dst + 24, table);
+        }
+        for (; pos + 8 <= src_len; pos += 5, dst += 8)
+        {
+            encode_word_swar(src + pos, dst, table);
+        }
+
+        return pos;
+    }
+
+    /// Decode one octet into 5 bytes; false (nothing written) when one of
+    /// the 8 characters is outside the alphabet.
+    inline bool decode_word_swar(
+        const char* src, char* dst, const DecodeTable& table)
+    {
+        const uint64_t v0 = table(src[0]);
+        const uint64_t v1 = table(src[1]);
+        const uint64_t v2 = table(src[2]);
+        const uint64_t v3 = table(src[3]);
+        const uint64_t v4 = table(src[4]);
+        const uint64_t v5 = table(src[5]);
+        const uint64_t v6 = table(src[6]);
+        const uint64_t v7 = table(src[7]);
+        if ((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) & 0x80)
+        {
+            return false;
+        }
+
+        const uint64_t bits =
+            v0 << 35 | v1 << 30 | v2 << 25 | v3 << 20 |
+            v4 << 15 | v5 << 10 | v6 << 5 | v7;
+
+        store_be<5>(dst, bits);
+        return true;
+    }
+
+    inline size_t decode_table_scalar(const char* src, const size_t src_len,
+        char* dst, const DecodeTable& table)
+    {
+        size_t pos = 0;
+        for (; pos + 32 <= src_len; pos += 32, dst += 20)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                return pos;
+            }
+            if (!decode_word_swar(src + pos + 8, dst + 5, table))
+            {
+                return pos + 8;
+            }
+            if (!decode_word_swar(src + pos + 16, dst + 10, table))
+            {
+                return pos + 16;
+            }
+            if (!decode_word_swar(src + pos + 24, dst + 15, table))
+            {
+                return pos + 24;
+            }
+        }
+        for (; pos + 8 <= src_len; pos += 8, dst += 5)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    inline size_t decode_scalar(const char* src, const size_t src_len,
+        char* dst, const DecodeRanges& ranges)
+    {
+        return decode_table_scalar(src, src_len, dst, ranges.table);
+    }
+
+    inline size_t decode_custom_scalar(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        return decode_table_scalar(src, src_len, dst, lut.table);
+    }
+
+    inline size_t validate_scalar(const char* src, const size_t src_len,
+        const DecodeRanges& ranges)
+    {
+        return validate_table_scalar(src, src_len, ranges.table);
+    }
+
+    /// Bulk kernels bound to each eSimdLevel.
+    struct Kernels
+    {
+        size_t (*encode)(const uint8_t* src, const size_t src_len,
+            char* dst, const uint8_t* table);
+        size_t (*decode)(const char* src, const size_t src_len,
+            char* dst, const DecodeRanges& ranges);
+        size_t (*validate)(const char* src, const size_t src_len,
+            const DecodeRanges& ranges);
+        size_t (*decode_custom)(const char* src, const size_t src_len,
+            char* dst, const NibbleLut& lut);
+    };
+
+    inline const Kernels& kernels()
+    {
+        static const Kernels table[] = {
+            // eSimdLevel::Scalar
+            { &encode_scalar, &decode_scalar, &validate_scalar,
+                &decode_custom_scalar },
+#if defined(BASEXX_X86_SIMD)
+            // eSimdLevel::SSE41
+            { &encode_sse41, &decode_sse41, &validate_sse41,
+                &decode_custom_sse41 },
+            // eSimdLevel::AVX2
+            { &encode_avx2, &decode_avx2, &validate_avx2,
+                &decode_custom_avx2 },
+            // eSimdLevel::AVX512BW
+            { &encode_avx2, &decode_avx2, &validate_avx2,
+                &decode_custom_avx2 },
+#endif  // defined(BASEXX_X86_SIMD)
+        };
+
+        return table[static_cast<size_t>(simd_level())];
+    }
+
+    /// Encode whole groups a kernel at a time: the active level first, the
+    /// SWAR words of the scalar level after it. Returns the bytes consumed.
+    inline size_t encode_words(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        const size_t pos = kernels().encode(src, src_len, dst, table);
+
+        return pos + encode_scalar(
+            src + pos, src_len - pos, dst + pos / 5 * 8, table);
+    }
+
+    /// SIMD plug-in of the Codec engine (see ScalarPlugin) for the alphabet
+    /// policies below, which derive from it.
+    template <typename Alphabet>
+    struct SimdPlugin
+    {
+        static size_t encode_bulk(
+            const uint8_t* src, const size_t src_len, char* dst)
+        {
+            return encode_words(src, src_len, dst, Alphabet::encoding());
+        }
+
+        static size_t decode_bulk(
+            const char* src, const size_t src_len, char* dst)
+        {
+            return kernels().decode(src, src_len, dst, Alphabet::ranges());
+        }
+
+        static size_t validate_bulk(const char* src, const size_t src_len)
+        {
+            return kernels().validate(src, src_len, Alphabet::ranges());
+        }
+    };
+
+    /// Alphabet policies of the encode/decode templates. Both tables are
+    /// compile-time constants, so the scalar loops index them directly.
+    struct StandardAlphabet : SimdPlugin<StandardAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return decode_table;
+        }
+
+        static constexpr const DecodeRanges& ranges()
+        {
+            return decode_ranges;
+        }
+    };
+
+    struct HexAlphabet : SimdPlugin<HexAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return hex_encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return hex_decode_table;
+        }
+
+        static constexpr const DecodeRanges& ranges()
+        {
+            return hex_decode_ranges;
+        }
+    };
+
+    /// Alphabets of the overloads taking an encoding table or a character
+    /// lookup chosen at run time, all of them forwarded to RuntimeCodec. The
+    /// built-in lookups (decode_char and hex_decode_char included) keep
+    /// the kernels of their policies, any other goes through the scalar
+    /// loops.
+    inline RuntimeAlphabet runtime_alphabet(const uint8_t* table)
+    {
+        return RuntimeAlphabet::encoder(table, &encode_words);
+    }
+
+    inline RuntimeAlphabet runtime_alphabet(
+        uint8_t (*value_func)(const char))
+    {
+        if (value_func == &decode_value || value_func == &decode_char)
+        {
+            return RuntimeAlphabet::decoder<StandardAlphabet>();
+        }
+        else if (value_func == &hex_decode_value ||
+                 value_func == &hex_decode_char)
+        {
+            return RuntimeAlphabet::decoder<HexAlphabet>();
+        }
+
+        return RuntimeAlphabet::decoder(value_func);
+    }
+
+    using RuntimeCodec = Codec<RuntimeAlphabet, 5>;
+
+
+    /// ========================================================================
+    /// Encoding & Decoding
+    /// ------------------------------------------------------------------------
+    /// The functions of Codec (see there) with the defaults of RFC 4648: the
+    /// templates take an alphabet policy, the other overloads an encoding
+    /// table or a character lookup. `value_func` maps a character to its
+    /// value or invalid_value; in the parallel functions it is called from
+    /// several threads and must not throw.
+    /// ========================================================================
+
+    inline size_t encode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(table));
+    }
+
+    inline std::string encode_base(const char* data,
+        const size_t data_len, const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode(
+            data, data_len, padding, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet>
+    inline std::string encode_base(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 5>::encode(data, data_len, padding);
+    }
+
+    template <typename Alphabet>
+    inline DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 5>::try_decode_into(
+            dst, dst_cap, data, data_len, padding);
+    }
+
+    inline DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::try_decode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(value_func));
+    }
+
+    template <typename Alphabet>
+    inline size_t decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 5>::decode_into(
+            dst, dst_cap, data, data_len, padding);
+    }
+
+    inline size_t decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode_into(dst, dst_cap, data, data_len,
+            padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode(const char* data, const size_t data_len,
+        Output& out, uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::try_decode(
+            data, data_len, out, padding, runtime_alphabet(value_func));
+    }
+
+    inline std::string decode_base(const char* data,
+        const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode(
+            data, data_len, padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Alphabet>
+    inline std::string decode_base(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 5>::decode(data, data_len, padding);
+    }
+
+    template <typename Output>
+    inline void encode_append(Output& out,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        RuntimeCodec::encode_append(
+            out, data, data_len, padding, runtime_alphabet(table));
+    }
+
+    template <typename Output>
+    inline void decode_append(Output& out,
+        const char* data, const size_t data_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        RuntimeCodec::decode_append(out, data, data_len,
+            padding, runtime_alphabet(decode_char_func));
+    }
+
+    inline size_t encode_inplace(char* buf, const size_t data_len,
+        const uint8_t* table = encoding_table,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::encode_inplace(
+            buf, data_len, padding, runtime_alphabet(table));
+    }
+
+    inline size_t decode_inplace(char* buf, const size_t text_len,
+        uint8_t (*decode_char_func)(const char) = &decode_char,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::decode_inplace(
+            buf, text_len, padding, runtime_alphabet(decode_char_func));
+    }
+
+    template <typename Alphabet>
+    inline DecodeResult validate(const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return Codec<Alphabet, 5>::validate(data, data_len, padding);
+    }
+
+    inline DecodeResult validate(const char* data, const size_t data_len,
+        uint8_t (*value_func)(const char) = &decode_value,
+        const ePadding padding = ePadding::Required)
+    {
+        return RuntimeCodec::validate(
+            data, data_len, padding, runtime_alphabet(value_func));
+    }
+
+
+    /// ========================================================================
+    /// Parallel & Columnar Coding
+    /// ------------------------------------------------------------------------
+    /// Forwards to RuntimeCodec, as above.
+    /// ========================================================================
+
+    inline size_t encode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    inline std::string encode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel(
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    inline DecodeResult try_decode_parallel_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const size_t threads = 0,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(value_func));
+    }
+
+    inline size_t decode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(decode_char_func));
+    }
+
+    inline std::string decode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_parallel(
+            data, data_len, threads, runtime_alphabet(decode_char_func));
+    }
+
+    inline size_t encoded_batch_length(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::encoded_batch_length(offsets, rows);
+    }
+
+    constexpr size_t decoded_batch_capacity(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::decoded_batch_capacity(offsets, rows);
+    }
+
+    inline size_t encode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch_into(dst, dst_cap, dst_offsets,
+            data, offsets, rows, runtime_alphabet(table));
+    }
+
+    inline void encode_batch(const Column& column, Column& out,
+        const uint8_t* table = encoding_table)
+    {
+        RuntimeCodec::encode_batch(column, out, runtime_alphabet(table));
+    }
+
+    inline Column encode_batch(
+        const Column& column, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch(column, runtime_alphabet(table));
+    }
+
+    inline size_t try_decode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, DecodeResult* results = nullptr,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_batch_into(dst, dst_cap, dst_offsets,
+            data, offsets, rows, results, runtime_alphabet(value_func));
+    }
+
+    inline size_t try_decode_batch(const Column& column, Column& out,
+        std::vector<RowError>& errors,
+        uint8_t (*value_func)(const char) = &decode_value)
+    {
+        return RuntimeCodec::try_decode_batch(
+            column, out, errors, runtime_alphabet(value_func));
+    }
+
+    inline Column decode_batch(const Column& column,
+        uint8_t (*decode_char_func)(const char) = &decode_char)
+    {
+        return RuntimeCodec::decode_batch(
+            column, runtime_alphabet(decode_char_func));
+    }
+
+    /// Streaming encoder of any encoding table (see Codec::Encoder).
+    class Encoder : public RuntimeCodec::Encoder
+    {
+    public:
+        explicit Encoder(const uint8_t* table = encoding_table)
+            : RuntimeCodec::Encoder(runtime_alphabet(table))
+        {
+        }
+    };
+
+    /// Streaming decoder of any encoding table (see Codec::Decoder).
+    class Decoder : public RuntimeCodec::Decoder
+    {
+    public:
+        explicit Decoder(const uint8_t* table = encoding_table)
+            : RuntimeCodec::Decoder(
+                kernels_of(table), make_decode_table(table, 32))
+        {
+        }
+
+    private:
+        /// The kernels of the built-in alphabet `table` holds, if any; the
+        /// decoder looks characters up in its own table.
+        static RuntimeAlphabet kernels_of(const uint8_t* table)
+        {
+            return (memcmp(table, encoding_table, 32) == 0)
+                ? RuntimeAlphabet::decoder<StandardAlphabet>()
+                : (memcmp(table, hex_encoding_table, 32) == 0)
+                    ? RuntimeAlphabet::decoder<HexAlphabet>()
+                    : RuntimeAlphabet::decoder(nullptr);
+        }
+    };
+
+
+    /// ========================================================================
+    /// Helper Functions
+    /// ========================================================================
+
+    inline size_t encode_hex_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return encode_into(
+            dst, dst_cap, data, data_len, hex_encoding_table, padding);
+    }
+
+    inline size_t decode_hex_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return decode_into(
+            dst, dst_cap, data, data_len, &hex_decode_char, padding);
+    }
+
+    template <typename Output>
+    inline void encode_hex_append(
+        Output& out, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        encode_append(out, data, data_len, hex_encoding_table, padding);
+    }
+
+    template <typename Output>
+    inline void decode_hex_append(
+        Output& out, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        decode_append(out, data, data_len, &hex_decode_char, padding);
+    }
+
+    inline size_t encode_hex_inplace(char* buf, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return encode_inplace(buf, data_len, hex_encoding_table, padding);
+    }
+
+    inline size_t decode_hex_inplace(char* buf, const size_t text_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return decode_inplace(buf, text_len, &hex_decode_char, padding);
+    }
+
+    inline DecodeResult try_decode_hex_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode_into(
+            dst, dst_cap, data, data_len, &hex_decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_hex(
+        const char* data, const size_t data_len, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(data, data_len, out, &hex_decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode(const ByteView text, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(
+            text.data(), text.size(), out, &decode_value, padding);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_hex(const ByteView text, Output& out,
+        const ePadding padding = ePadding::Required)
+    {
+        return try_decode(
+            text.data(), text.size(), out, &hex_decode_value, padding);
+    }
+
+    /// Encode into a fixed-size contiguous container such as std::array;
+    /// returns the number of characters written.
+    template <typename Output>
+    inline size_t encode_into(Output& out, const ByteView bytes)
+    {
+        return encode_into(
+            output_data(out, 0), out.size(), bytes.data(), bytes.size());
+    }
+
+    /// Decode into a fixed-size contiguous container such as
+    /// std::array<uint8_t, N>; returns the number of bytes written.
+    template <typename Output>
+    inline size_t decode_into(Output& out, const ByteView text)
+    {
+        return decode_into(
+            output_data(out, 0), out.size(), text.data(), text.size());
+    }
+
+    inline std::string encode(const ByteView bytes = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base<StandardAlphabet>(
+                bytes.data(), bytes.size(), padding);
+    }
+
+    inline std::string encode_hex(const ByteView bytes = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base<HexAlphabet>(bytes.data(), bytes.size(), padding);
+    }
+
+    inline std::string decode(const ByteView text = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base<StandardAlphabet>(text.data(), text.size(), padding);
+    }
+
+    inline std::string decode_hex(const ByteView text = {},
+        const ePadding padding = ePadding::Required)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base<HexAlphabet>(text.data(), text.size(), padding);
+    }
+
+    /// Whether `text` decodes, checked without decoding it (see validate()).
+    inline bool is_valid(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return static_cast<bool>(validate<StandardAlphabet>(
+            text.data(), text.size(), padding));
+    }
+
+    inline bool is_valid_hex(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return static_cast<bool>(validate<HexAlphabet>(
+            text.data(), text.size(), padding));
+    }
+
+    /// Decoded length of `text` in `written`, or its first error, without
+    /// decoding it; e.g. for size limits ahead of a decode.
+    inline DecodeResult decoded_size(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return validate<StandardAlphabet>(text.data(), text.size(), padding);
+    }
+
+    inline DecodeResult decoded_size_hex(const ByteView text,
+        const ePadding padding = ePadding::Required)
+    {
+        return validate<HexAlphabet>(text.data(), text.size(), padding);
+    }
+
+    /// Result in an `Output` container built with `alloc`, e.g.
+    /// encode<std::pmr::string>(str, &arena) or
+    /// decode<std::vector<uint8_t, MyAllocator>>(str).
+    template <typename Output>
+    inline Output encode(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output encode_hex(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_hex_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode_hex(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_hex_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+
+    /// ========================================================================
+    /// Compile-time Literals
+    /// ========================================================================
+
+    /// Encoding of a string literal (without its terminating NUL) or of a
+    /// std::array of bytes, usable in constant expressions, e.g.
+    ///     constexpr auto magic = base32::encode_literal<HexAlphabet>("id");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N - 1)> encode_literal(
+        const char (&str)[N])
+    {
+        return encode_static<5, Alphabet, N - 1>(
+            str, std::make_index_sequence<encoded_length(N - 1)>{});
+    }
+
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N)> encode_literal(
+        const std::array<uint8_t, N>& bytes)
+    {
+        return encode_static<5, Alphabet, N>(
+            bytes, std::make_index_sequence<encoded_length(N)>{});
+    }
+
+    /// Decoding of a string literal, usable in constant expressions; a
+    /// malformed literal is a compile error there, e.g.
+    ///     constexpr auto key = base32::decode_literal("MZXW6===");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr StaticBytes<(N - 1) / 8 * 5> decode_literal(
+        const char (&text)[N])
+    {
+        return decode_static<5, 8, Alphabet>(
+            text, N - 1, std::make_index_sequence<(N - 1) / 8 * 5>{});
+    }
+}  // namespace BaseXX::_32_
+
+namespace _16_
+{
+    /// ========================================================================
+    /// Base16 Encoding/Decoding Implementation
+    /// ========================================================================
+
+    /// The Base 16 Alphabet Table
+    /// https://datatracker.ietf.org/doc/html/rfc4648#section-8
+    ///
+    static constexpr uint8_t encoding_table[16] = {
+        '0', '1', '2', '3', '4', '5', '6', '7',  // 0 ~ 7
+        '8', '9', 'A', 'B', 'C', 'D', 'E', 'F',  // 8 ~ 15
+    };
+
+    /// Lower-case variant, the usual form of digests and trace IDs.
+    static constexpr uint8_t lowercase_encoding_table[16] = {
+        '0', '1', '2', '3', '4', '5', '6', '7',  // 0 ~ 7
+        '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',  // 8 ~ 15
+    };
+
+    /// Reverse tables: character -> 4-bit value, invalid_value otherwise
+    static constexpr DecodeTable decode_table =
+        make_decode_table(encoding_table);
+    static constexpr DecodeTable lowercase_decode_table =
+        make_decode_table(lowercase_encoding_table);
+    static constexpr DecodeTable any_case_decode_table =
+        merge_decode_tables(decode_table, lowercase_decode_table);
+
+    /// Letter cases ('A' ~ 'F' / 'a' ~ 'f') accepted by a decoder.
+    enum class eLetterCase
+    {
+        Upper = 1,
+        Lower = 2,
+        Any   = Upper | Lower,  // 3
+    };
+
+    /// Length of the encoding of `data_len` bytes.
+    constexpr size_t encoded_length(const size_t data_len)
+    {
+        return Geometry<4>::encoded_length(data_len, ePadding::Required);
+    }
+
+    /// Decoded length of an encoded text (Base16 has no padding).
+    constexpr size_t decoded_length(
+        const char* encoded_text, const size_t text_len)
+    {
+        return Geometry<4>::decoded_length(encoded_text, text_len);
+    }
+
+    /// Value of a character, or invalid_value outside the alphabet.
+    constexpr uint8_t decode_value(const char c) noexcept
+    {
+        return decode_table(c);
+    }
+
+    inline uint8_t decode_char(const char c)
+    {
+        return decode_value_or_throw(decode_value, c, __FUNCTION__);
+    }
+
+    /// ========================================================================
+    /// SIMD Kernels
+    /// ------------------------------------------------------------------------
+    /// Encode kernels return the number of bytes consumed; decode kernels
+    /// take whole character pairs and return the number of characters
+    /// consumed, stopping in front of the first invalid block.
+    /// Encoding splits every byte into nibbles, maps them through the
+    /// 16-entry table with one shuffle and interleaves the halves; decoding
+    /// classifies digits and letters with range compares and packs each
+    /// pair with a multiply-add.
+    /// ========================================================================
+
+#if defined(BASEXX_X86_SIMD)
+    /// Characters of 16 bytes, high nibble first.
+    BASEXX_TARGET_SSE41
+    inline void encode_block_ssse3(
+        const __m128i in, const __m128i table, char* dst)
+    {
+        const __m128i mask = _mm_set1_epi8(0x0F);
+        const __m128i hi = _mm_shuffle_epi8(
+            table, _mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        const __m128i lo = _mm_shuffle_epi8(table, _mm_and_si128(in, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+            _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 16),
+            _mm_unpackhi_epi8(hi, lo));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t encode_ssse3(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        const __m128i lut =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table));
+
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            encode_block_ssse3(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                lut, dst + pos * 2);
+        }
+
+        return pos;
+    }
+
+    /// Values of 16 characters; `valid` gets 0xFF in every lane holding a
+    /// digit or a letter of the accepted case.
+    BASEXX_TARGET_SSE41
+    inline __m128i decode_translate_sse41(
+        const __m128i in, const eLetterCase letters, __m128i& valid)
+    {
+        // Setting bit 5 folds 'A' ~ 'F' onto 'a' ~ 'f' and nothing else
+        // there, but it also folds 0x10 ~ 0x19 onto the digits: only the
+        // letter test sees the folded input.
+        const __m128i folded = (letters == eLetterCase::Any)
+            ? _mm_or_si128(in, _mm_set1_epi8(0x20))
+            : in;
+        const char first_letter = (letters == eLetterCase::Upper) ? 'A' : 'a';
+
+        const __m128i digit = _mm_sub_epi8(in, _mm_set1_epi8('0'));
+        const __m128i letter =
+            _mm_sub_epi8(folded, _mm_set1_epi8(first_letter));
+        const __m128i is_digit = _mm_cmpeq_epi8(
+            _mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+        const __m128i is_letter = _mm_cmpeq_epi8(
+            _mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+        valid = _mm_or_si128(is_digit, is_letter);
+        return _mm_or_si128(_mm_and_si128(is_digit, digit),
+            _mm_and_si128(is_letter,
+                _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    }
+
+    /// Pack 16 values into 8 bytes, hi * 16 + lo for every pair, and store
+    /// them.
+    BASEXX_TARGET_SSE41
+    inline void decode_pack_store_sse41(char* dst, const __m128i values)
+    {
+        const __m128i words =
+            _mm_maddubs_epi16(values, _mm_set1_epi16(0x0110));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst),
+            _mm_packus_epi16(words, words));
+    }
+
+    BASEXX_TARGET_SSE41
+    inline size_t decode_sse41(const char* src, const size_t src_len,
+        char* dst, const eLetterCase letters)
+    {
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i valid;
+            const __m128i values = decode_translate_sse41(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                letters, valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF)
+            {
+                break;
+            }
+
+            decode_pack_store_sse41(dst + pos / 2, values);
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t encode_avx2(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        const __m256i lut = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(table)));
+        const __m256i mask = _mm256_set1_epi8(0x0F);
+
+        size_t pos = 0;
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            const __m256i in = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos));
+            const __m256i hi = _mm256_shuffle_epi8(
+                lut, _mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+            const __m256i lo = _mm256_shuffle_epi8(
+                lut, _mm256_and_si256(in, mask));
+
+            // unpack works per 128-bit lane: put the halves back in order
+            const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+            const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + pos * 2),
+                _mm256_permute2x128_si256(first, second, 0x20));
+            _mm256_storeu_si256(
+                reinterpret_cast<__m256i*>(dst + pos * 2 + 32),
+                _mm256_permute2x128_si256(first, second, 0x31));
+        }
+
+        return pos + encode_ssse3(src + pos, src_len - pos,
+            dst + pos * 2, table);
+    }
+
+    /// Same as decode_pack_store_sse41() for 32 values.
+    BASEXX_TARGET_AVX2
+    inline void decode_pack_store_avx2(char* dst, const __m256i values)
+    {
+        const __m256i words =
+            _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+        const __m256i packed = _mm256_permute4x64_epi64(
+            _mm256_packus_epi16(words, words), 0x08);  // 0, 2
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+            _mm256_castsi256_si128(packed));
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_avx2(const char* src, const size_t src_len,
+        char* dst, const eLetterCase letters)
+    {
+        const char first_letter = (letters == eLetterCase::Upper) ? 'A' : 'a';
+        const __m256i fold = _mm256_set1_epi8(
+            (letters == eLetterCase::Any) ? 0x20 : 0x00);
+
+        size_t pos = 0;
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            const __m256i in = _mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos));
+
+            // As in decode_translate_sse41(), digits are tested unfolded
+            const __m256i digit = _mm256_sub_epi8(in, _mm256_set1_epi8('0'));
+            const __m256i letter = _mm256_sub_epi8(
+                _mm256_or_si256(in, fold), _mm256_set1_epi8(first_letter));
+            const __m256i is_digit = _mm256_cmpeq_epi8(
+                _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+            const __m256i is_letter = _mm256_cmpeq_epi8(
+                _mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+            if (_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_letter))
+                != -1)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 2, _mm256_or_si256(
+                _mm256_and_si256(is_digit, digit),
+                _mm256_and_si256(is_letter,
+                    _mm256_add_epi8(letter, _mm256_set1_epi8(10)))));
+        }
+
+        return pos + decode_sse41(src + pos, src_len - pos,
+            dst + pos / 2, letters);
+    }
+
+    /// Validation kernels: the range compares of the decode kernels alone,
+    /// returning the number of characters in front of the first block that
+    /// holds one outside the alphabet.
+    BASEXX_TARGET_SSE41
+    inline size_t validate_sse41(const char* src, const size_t src_len,
+        const eLetterCase letters)
+    {
+        size_t pos = 0;
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i valid;
+            decode_translate_sse41(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                letters, valid);
+            if (_mm_movemask_epi8(valid) != 0xFFFF)
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t validate_avx2(const char* src, const size_t src_len,
+        const eLetterCase letters)
+    {
+        const char first_letter = (letters == eLetterCase::Upper) ? 'A' : 'a';
+        const __m256i fold = _mm256_set1_epi8(
+            (letters == eLetterCase::Any) ? 0x20 : 0x00);
+        const __m256i zero_char = _mm256_set1_epi8('0');
+        const __m256i a_char = _mm256_set1_epi8(first_letter);
+
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m256i valid = _mm256_set1_epi8(-1);
+            for (size_t k = 0; k < 64; k += 32)
+            {
+                const __m256i in = _mm256_loadu_si256(
+                    reinterpret_cast<const __m256i*>(src + pos + k));
+                const __m256i digit = _mm256_sub_epi8(in, zero_char);
+                const __m256i letter =
+                    _mm256_sub_epi8(_mm256_or_si256(in, fold), a_char);
+                valid = _mm256_and_si256(valid, _mm256_or_si256(
+                    _mm256_cmpeq_epi8(
+                        _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit),
+                    _mm256_cmpeq_epi8(
+                        _mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter)));
+            }
+            if (_mm256_movemask_epi8(valid) != -1)
+            {
+                break;
+            }
+        }
+
+        return pos + validate_sse41(src + pos, src_len - pos, letters);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+#if defined(BASEXX_X86_SIMD)
+    /// Decode kernels of the alphabets chosen at run time (see
+    /// CustomAlphabet): the values of translate_ssse3() & translate_avx2(),
+    /// packed as above. Any table can be encoded by the kernels above.
+    BASEXX_TARGET_SSE41
+    inline size_t decode_custom_sse41(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 64 <= src_len; pos += 64)
+        {
+            __m128i values[4];
+            __m128i error = _mm_setzero_si128();
+            translate_x4_ssse3(src + pos, lut, values, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_sse41(
+                dst + pos / 2, values[0]);
+            decode_pack_store_sse41(
+                dst + pos / 2 + 8, values[1]);
+            decode_pack_store_sse41(
+                dst + pos / 2 + 16, values[2]);
+            decode_pack_store_sse41(
+                dst + pos / 2 + 24, values[3]);
+        }
+        for (; pos + 16 <= src_len; pos += 16)
+        {
+            __m128i error = _mm_setzero_si128();
+            const __m128i values = translate_ssse3(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + pos)),
+                lut, error);
+            if (_mm_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_sse41(dst + pos / 2, values);
+        }
+
+        return pos;
+    }
+
+    BASEXX_TARGET_AVX2
+    inline size_t decode_custom_avx2(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        size_t pos = 0;
+        for (; pos + 128 <= src_len; pos += 128)
+        {
+            __m256i values[4];
+            __m256i error = _mm256_setzero_si256();
+            translate_x4_avx2(src + pos, lut, values, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(
+                dst + pos / 2, values[0]);
+            decode_pack_store_avx2(
+                dst + pos / 2 + 16, values[1]);
+            decode_pack_store_avx2(
+                dst + pos / 2 + 32, values[2]);
+            decode_pack_store_avx2(
+                dst + pos / 2 + 48, values[3]);
+        }
+        for (; pos + 32 <= src_len; pos += 32)
+        {
+            __m256i error = _mm256_setzero_si256();
+            const __m256i values = translate_avx2(_mm256_loadu_si256(
+                reinterpret_cast<const __m256i*>(src + pos)), lut, error);
+            if (_mm256_movemask_epi8(error) != 0)
+            {
+                break;
+            }
+
+            decode_pack_store_avx2(dst + pos / 2, values);
+        }
+
+        return pos + decode_custom_sse41(
+            src + pos, src_len - pos, dst + pos / 2, lut);
+    }
+#endif  // defined(BASEXX_X86_SIMD)
+
+    /// SWAR kernels of the scalar level. Encoding spreads 4 bytes over the
+    /// 8 bytes of a word, one nibble each, and turns all of them into
+    /// characters at once: '0' + n, plus 7 ('A' - '9' - 1) or 39 for the
+    /// lower case when n > 9. Only the two RFC 4648 tables are supported.
+    inline void encode_word_swar(
+        const uint8_t* src, char* dst, const uint64_t letter_offset)
+    {
+        uint64_t x = static_cast<uint64_t>(src[0]) |
+                     (static_cast<uint64_t>(src[1]) << 16) |
+                     (static_cast<uint64_t>(src[2]) << 32) |
+                     (static_cast<uint64_t>(src[3]) << 48);
+
+        // High nibble first: it goes to the lower byte of each 16-bit lane
+        x = ((x >> 4) & 0x000F000F000F000FULL) |
+            ((x & 0x000F000F000F000FULL) << 8);
+
+        const uint64_t letters =
+            ((x + 0x0606060606060606ULL) >> 4) & 0x0101010101010101ULL;
+        store_le64(dst, x + 0x3030303030303030ULL + letters * letter_offset);
+    }
+
+    inline size_t encode_scalar(const uint8_t* src, const size_t src_len,
+        char* dst, const uint8_t* table)
+    {
+        const uint64_t letter_offset =
+            (memcmp(table, encoding_table, 16) == 0) ? 7
+            : (memcmp(table, lowercase_encoding_table, 16) == 0) ? 39
+            : 0;
+        if (letter_offset == 0)
+        {
+            return 0;
+        }
+
+        size_t pos = 0;
+        for (; pos + 12 <= src_len; pos += 12, dst += 24)
+        {
+            encode_word_swar(src + pos, dst, letter_offset);
+            encode_word_swar(src + pos + 4, dst + 8, letter_offset);
+            encode_word_swar(src + pos + 8, dst + 16, letter_offset);
+        }
+        for (; pos + 4 <= src_len; pos += 4, dst += 8)
+        {
+            encode_word_swar(src + pos, dst, letter_offset);
+        }
+
+        return pos;
+    }
+
+    /// Decode 8 characters into 4 bytes; false (nothing written) when one
+    /// of them is outside the alphabet.
+    inline bool decode_word_swar(
+        const char* src, char* dst, const DecodeTable& table)
+    {
+        const uint64_t v0 = table(src[0]);
+        const uint64_t v1 = table(src[1]);
+        const uint64_t v2 = table(src[2]);
+        const uint64_t v3 = table(src[3]);
+        const uint64_t v4 = table(src[4]);
+        const uint64_t v5 = table(src[5]);
+        const uint64_t v6 = table(src[6]);
+        const uint64_t v7 = table(src[7]);
+        if ((v0 | v1 | v2 | v3 | v4 | v5 | v6 | v7) & 0x80)
+        {
+            return false;
+        }
+
+        const uint64_t bits =
+            v0 << 28 | v1 << 24 | v2 << 20 | v3 << 16 |
+            v4 << 12 | v5 << 8 | v6 << 4 | v7;
+
+        store_be<4>(dst, bits);
+        return true;
+    }
+
+    /// The DecodeTable of each accepted letter case.
+    inline const DecodeTable& letters_decode_table(const eLetterCase letters)
+    {
+        return (letters == eLetterCase::Upper)
+            ? decode_table
+            : (letters == eLetterCase::Lower)
+                ? lowercase_decode_table
+                : any_case_decode_table;
+    }
+
+    inline size_t decode_table_scalar(const char* src, const size_t src_len,
+        char* dst, const DecodeTable& table)
+    {
+        size_t pos = 0;
+        for (; pos + 24 <= src_len; pos += 24, dst += 12)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                return pos;
+            }
+            if (!decode_word_swar(src + pos + 8, dst + 4, table))
+            {
+                return pos + 8;
+            }
+            if (!decode_word_swar(src + pos + 16, dst + 8, table))
+            {
+                return pos + 16;
+            }
+        }
+        for (; pos + 8 <= src_len; pos += 8, dst += 4)
+        {
+            if (!decode_word_swar(src + pos, dst, table))
+            {
+                break;
+            }
+        }
+
+        return pos;
+    }
+
+    inline size_t decode_scalar(const char* src, const size_t src_len,
+        char* dst, const eLetterCase letters)
+    {
+        return decode_table_scalar(
+            src, src_len, dst, letters_decode_table(letters));
+    }
+
+    inline size_t decode_custom_scalar(const char* src, const size_t src_len,
+        char* dst, const NibbleLut& lut)
+    {
+        return decode_table_scalar(src, src_len, dst, lut.table);
+    }
+
+    inline size_t validate_scalar(const char* src, const size_t src_len,
+        const eLetterCase letters)
+    {
+        return validate_table_scalar(
+            src, src_len, letters_decode_table(letters));
+    }
+
+    /// Bulk kernels bound to each eSimdLevel.
+    struct Kernels
+    {
+        size_t (*encode)(const uint8_t* src, const size_t src_len,
+            char* dst, const uint8_t* table);
+        size_t (*decode)(const char* src, const size_t src_len,
+            char* dst, const eLetterCase letters);
+        size_t (*validate)(const char* src, const size_t src_len,
+            const eLetterCase letters);
+        size_t (*decode_custom)(const char* src, const size_t src_len,
+            char* dst, const NibbleLut& lut);
+    };
+
+    inline const Kernels& kernels()
+    {
+        static const Kernels table[] = {
+            // eSimdLevel::Scalar
+            { &encode_scalar, &decode_scalar, &validate_scalar,
+                &decode_custom_scalar },
+#if defined(BASEXX_X86_SIMD)
+            // eSimdLevel::SSE41
+            { &encode_ssse3, &decode_sse41, &validate_sse41,
+                &decode_custom_sse41 },
+            // eSimdLevel::AVX2
+            { &encode_avx2, &decode_avx2, &validate_avx2,
+                &decode_custom_avx2 },
+            // eSimdLevel::AVX512BW
+            { &encode_avx2, &decode_avx2, &validate_avx2,
+                &decode_custom_avx2 },
+#endif  // defined(BASEXX_X86_SIMD)
+        };
+
+        return table[static_cast<size_t>(simd_level())];
+    }
+
+    /// Encode whole bytes a kernel at a time: the active level first, the
+    /// SWAR words of the scalar level after it. Returns the bytes consumed.
+    inline size_t encode_words(const uint8_t* src,
+        const size_t src_len, char* dst, const uint8_t* table)
+    {
+        const size_t pos = kernels().encode(src, src_len, dst, table);
+
+        return pos + encode_scalar(
+            src + pos, src_len - pos, dst + pos * 2, table);
+    }
+
+    /// SIMD plug-in of the Codec engine (see ScalarPlugin) for the alphabet
+    /// policies below, which derive from it.
+    template <typename Alphabet>
+    struct SimdPlugin
+    {
+        static size_t encode_bulk(
+            const uint8_t* src, const size_t src_len, char* dst)
+        {
+            return encode_words(src, src_len, dst, Alphabet::encoding());
+        }
+
+        static size_t decode_bulk(
+            const char* src, const size_t src_len, char* dst)
+        {
+            return kernels().decode(src, src_len, dst, Alphabet::letters());
+        }
+
+        static size_t validate_bulk(const char* src, const size_t src_len)
+        {
+            return kernels().validate(src, src_len, Alphabet::letters());
+        }
+    };
+
+    /// Alphabet policies of the encode/decode templates. Both tables are
+    /// compile-time constants, so the scalar loops index them directly.
+    struct StandardAlphabet : SimdPlugin<StandardAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return decode_table;
+        }
+
+        static constexpr eLetterCase letters()
+        {
+            return eLetterCase::Upper;
+        }
+    };
+
+    struct LowercaseAlphabet : SimdPlugin<LowercaseAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return lowercase_encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return lowercase_decode_table;
+        }
+
+        static constexpr eLetterCase letters()
+        {
+            return eLetterCase::Lower;
+        }
+    };
+
+    /// Upper-case output; either case, even mixed, on input.
+    struct AnyCaseAlphabet : SimdPlugin<AnyCaseAlphabet>
+    {
+        static constexpr const uint8_t* encoding()
+        {
+            return encoding_table;
+        }
+
+        static constexpr const DecodeTable& decoding()
+        {
+            return any_case_decode_table;
+        }
+
+        static constexpr eLetterCase letters()
+        {
+            return eLetterCase::Any;
+        }
+    };
+
+    /// Alphabets of the overloads taking an encoding table or a letter case
+    /// chosen at run time, all of them forwarded to RuntimeCodec.
+    inline RuntimeAlphabet runtime_alphabet(const uint8_t* table)
+    {
+        return RuntimeAlphabet::encoder(table, &encode_words);
+    }
+
+    inline RuntimeAlphabet runtime_alphabet(const eLetterCase letters)
+    {
+        return (letters == eLetterCase::Upper)
+            ? RuntimeAlphabet::decoder<StandardAlphabet>()
+            : (letters == eLetterCase::Lower)
+                ? RuntimeAlphabet::decoder<LowercaseAlphabet>()
+                : RuntimeAlphabet::decoder<AnyCaseAlphabet>();
+    }
+
+    using RuntimeCodec = Codec<RuntimeAlphabet, 4>;
+
+
+    /// ========================================================================
+    /// Encoding & Decoding
+    /// ------------------------------------------------------------------------
+    /// The functions of Codec (see there), without padding: the encoders
+    /// take an encoding table, the decoders an alphabet policy.
+    /// ========================================================================
+
+    inline size_t encode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_into(dst, dst_cap, data, data_len,
+            ePadding::Required, runtime_alphabet(table));
+    }
+
+    inline std::string encode_base(const char* data,
+        const size_t data_len, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode(
+            data, data_len, ePadding::Required, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet>
+    inline std::string encode_base(const char* data, const size_t data_len)
+    {
+        return Codec<Alphabet, 4>::encode(data, data_len);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len)
+    {
+        return Codec<Alphabet, 4>::try_decode_into(
+            dst, dst_cap, data, data_len);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline size_t decode_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len)
+    {
+        return Codec<Alphabet, 4>::decode_into(dst, dst_cap, data, data_len);
+    }
+
+    template <typename Alphabet = StandardAlphabet, typename Output>
+    inline DecodeResult try_decode(
+        const char* data, const size_t data_len, Output& out)
+    {
+        return Codec<Alphabet, 4>::try_decode(data, data_len, out);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline std::string decode_base(const char* data, const size_t data_len)
+    {
+        return Codec<Alphabet, 4>::decode(data, data_len);
+    }
+
+    template <typename Output>
+    inline void encode_append(Output& out,
+        const char* data, const size_t data_len,
+        const uint8_t* table = encoding_table)
+    {
+        RuntimeCodec::encode_append(out, data, data_len,
+            ePadding::Required, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet = StandardAlphabet, typename Output>
+    inline void decode_append(
+        Output& out, const char* data, const size_t data_len)
+    {
+        Codec<Alphabet, 4>::decode_append(out, data, data_len);
+    }
+
+    inline size_t encode_inplace(char* buf, const size_t data_len,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_inplace(
+            buf, data_len, ePadding::Required, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline size_t decode_inplace(char* buf, const size_t text_len)
+    {
+        return Codec<Alphabet, 4>::decode_inplace(buf, text_len);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline DecodeResult validate(const char* data, const size_t data_len)
+    {
+        return Codec<Alphabet, 4>::validate(data, data_len);
+    }
+
+
+    /// ========================================================================
+    /// Parallel & Columnar Coding
+    /// ------------------------------------------------------------------------
+    /// Forwards to Codec, as above.
+    /// ========================================================================
+
+    inline size_t encode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel_into(dst, dst_cap,
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    inline std::string encode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0,
+        const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_parallel(
+            data, data_len, threads, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline DecodeResult try_decode_parallel_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len,
+        const size_t threads = 0)
+    {
+        return Codec<Alphabet, 4>::try_decode_parallel_into(
+            dst, dst_cap, data, data_len, threads);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline size_t decode_parallel_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len, const size_t threads = 0)
+    {
+        return Codec<Alphabet, 4>::decode_parallel_into(
+            dst, dst_cap, data, data_len, threads);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline std::string decode_parallel(const char* data,
+        const size_t data_len, const size_t threads = 0)
+    {
+        return Codec<Alphabet, 4>::decode_parallel(data, data_len, threads);
+    }
+
+    inline size_t encoded_batch_length(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::encoded_batch_length(offsets, rows);
+    }
+
+    constexpr size_t decoded_batch_capacity(
+        const size_t* offsets, const size_t rows)
+    {
+        return RuntimeCodec::decoded_batch_capacity(offsets, rows);
+    }
+
+    inline size_t encode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch_into(dst, dst_cap, dst_offsets,
+            data, offsets, rows, runtime_alphabet(table));
+    }
+
+    inline void encode_batch(const Column& column, Column& out,
+        const uint8_t* table = encoding_table)
+    {
+        RuntimeCodec::encode_batch(column, out, runtime_alphabet(table));
+    }
+
+    inline Column encode_batch(
+        const Column& column, const uint8_t* table = encoding_table)
+    {
+        return RuntimeCodec::encode_batch(column, runtime_alphabet(table));
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline size_t try_decode_batch_into(char* dst, const size_t dst_cap,
+        size_t* dst_offsets, const char* data, const size_t* offsets,
+        const size_t rows, DecodeResult* results = nullptr)
+    {
+        return Codec<Alphabet, 4>::try_decode_batch_into(
+            dst, dst_cap, dst_offsets, data, offsets, rows, results);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline size_t try_decode_batch(const Column& column, Column& out,
+        std::vector<RowError>& errors)
+    {
+        return Codec<Alphabet, 4>::try_decode_batch(column, out, errors);
+    }
+
+    template <typename Alphabet = StandardAlphabet>
+    inline Column decode_batch(const Column& column)
+    {
+        return Codec<Alphabet, 4>::decode_batch(column);
+    }
+
+    /// Streaming decoder of any letter case (see Codec::Decoder).
+    class Decoder : public RuntimeCodec::Decoder
+    {
+    public:
+        explicit Decoder(const eLetterCase letters = eLetterCase::Upper)
+            : RuntimeCodec::Decoder(
+                runtime_alphabet(letters), letters_decode_table(letters))
+        {
+        }
+    };
+
+
+    /// ========================================================================
+    /// Helper Functions
+    /// ========================================================================
+
+    inline size_t encode_lower_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len)
+    {
+        return encode_into(
+            dst, dst_cap, data, data_len, lowercase_encoding_table);
+    }
+
+    inline size_t decode_any_case_into(char* dst, const size_t dst_cap,
+        const char* data, const size_t data_len)
+    {
+        return decode_into<AnyCaseAlphabet>(dst, dst_cap, data, data_len);
+    }
+
+    template <typename Output>
+    inline void encode_lower_append(
+        Output& out, const char* data, const size_t data_len)
+    {
+        encode_append(out, data, data_len, lowercase_encoding_table);
+    }
+
+    template <typename Output>
+    inline void decode_any_case_append(
+        Output& out, const char* data, const size_t data_len)
+    {
+        decode_append<AnyCaseAlphabet>(out, data, data_len);
+    }
+
+    inline size_t encode_lower_inplace(char* buf, const size_t data_len)
+    {
+        return encode_inplace(buf, data_len, lowercase_encoding_table);
+    }
+
+    inline size_t decode_any_case_inplace(char* buf, const size_t text_len)
+    {
+        return decode_inplace<AnyCaseAlphabet>(buf, text_len);
+    }
+
+    inline DecodeResult try_decode_any_case_into(char* dst,
+        const size_t dst_cap, const char* data, const size_t data_len)
+    {
+        return try_decode_into<AnyCaseAlphabet>(dst, dst_cap, data, data_len);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode(const ByteView text, Output& out)
+    {
+        return try_decode(text.data(), text.size(), out);
+    }
+
+    template <typename Output>
+    inline DecodeResult try_decode_any_case(const ByteView text, Output& out)
+    {
+        return try_decode<AnyCaseAlphabet>(text.data(), text.size(), out);
+    }
+
+    /// Encode into a fixed-size contiguous container such as std::array;
+    /// returns the number of characters written.
+    template <typename Output>
+    inline size_t encode_into(Output& out, const ByteView bytes)
+    {
+        return encode_into(
+            output_data(out, 0), out.size(), bytes.data(), bytes.size());
+    }
+
+    /// Decode into a fixed-size contiguous container such as
+    /// std::array<uint8_t, N>; returns the number of bytes written.
+    template <typename Alphabet = StandardAlphabet, typename Output>
+    inline size_t decode_into(Output& out, const ByteView text)
+    {
+        return decode_into<Alphabet>(
+            output_data(out, 0), out.size(), text.data(), text.size());
+    }
+
+    inline std::string encode(const ByteView bytes)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base(bytes.data(), bytes.size());
+    }
+
+    inline std::string encode_lower(const ByteView bytes)
+    {
+        return (bytes.empty())
+            ? std::string("")
+            : encode_base<LowercaseAlphabet>(bytes.data(), bytes.size());
+    }
+
+    inline std::string decode(const ByteView text)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base(text.data(), text.size());
+    }
+
+    inline std::string decode_any_case(const ByteView text)
+    {
+        return (text.empty())
+            ? std::string("")
+            : decode_base<AnyCaseAlphabet>(text.data(), text.size());
+    }
+
+    /// Whether `text` decodes, checked without decoding it (see validate()).
+    inline bool is_valid(const ByteView text)
+    {
+        return static_cast<bool>(validate(text.data(), text.size()));
+    }
+
+    inline bool is_valid_any_case(const ByteView text)
+    {
+        return static_cast<bool>(
+            validate<AnyCaseAlphabet>(text.data(), text.size()));
+    }
+
+    /// Decoded length of `text` in `written`, or its first error, without
+    /// decoding it; e.g. for size limits ahead of a decode.
+    inline DecodeResult decoded_size(const ByteView text)
+    {
+        return validate(text.data(), text.size());
+    }
+
+    inline DecodeResult decoded_size_any_case(const ByteView text)
+    {
+        return validate<AnyCaseAlphabet>(text.data(), text.size());
+    }
+
+    /// Result in an `Output` container built with `alloc`, e.g.
+    /// encode<std::pmr::string>(str, &arena) or
+    /// decode<std::vector<uint8_t, MyAllocator>>(str).
+    template <typename Output>
+    inline Output encode(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output encode_lower(const ByteView bytes,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        encode_lower_append(out, bytes.data(), bytes.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+    template <typename Output>
+    inline Output decode_any_case(const ByteView text,
+        const typename Output::allocator_type& alloc = {})
+    {
+        Output out(alloc);
+        decode_any_case_append(out, text.data(), text.size());
+
+        return out;
+    }
+
+
+    /// ========================================================================
+    /// Compile-time Literals
+    /// ========================================================================
+
+    /// Encoding of a string literal (without its terminating NUL) or of a
+    /// std::array of bytes, usable in constant expressions, e.g.
+    ///     constexpr auto magic = base16::encode_literal("\x7F" "ELF");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N - 1)> encode_literal(
+        const char (&str)[N])
+    {
+        return encode_static<4, Alphabet, N - 1>(
+            str, std::make_index_sequence<encoded_length(N - 1)>{});
+    }
+
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr std::array<char, encoded_length(N)> encode_literal(
+        const std::array<uint8_t, N>& bytes)
+    {
+        return encode_static<4, Alphabet, N>(
+            bytes, std::make_index_sequence<encoded_length(N)>{});
+    }
+
+    /// Decoding of a string literal, usable in constant expressions; a
+    /// malformed literal is a compile error there, e.g.
+    ///     constexpr auto key = base16::decode_literal("DEADBEEF");
+    template <typename Alphabet = StandardAlphabet, size_t N>
+    constexpr StaticBytes<(N - 1) / 2> decode_literal(
+        const char (&text)[N])
+    {
+        return decode_static<4, 2, Alphabet>(
+            text, N - 1, std::make_index_sequence<(N - 1) / 2>{});
+    }
+}  // namespace BaseXX::_16_
+
+    /// ========================================================================
+    /// Custom Alphabets
+    /// ------------------------------------------------------------------------
+    /// Alphabets of 16, 32 or 64 characters chosen at run time, e.g. the
+    /// bcrypt and IMAP (RFC 3501) flavors of Base64 or Crockford's Base32.
+    /// The alphabet is checked and its tables are built once, on
+    /// construction: the encoding table, the DecodeTable of the scalar loops
+    /// and the NibbleLut of the decode kernels. Every call then runs the
+    /// Codec engine on the kernels of _64_, _32_ or _16_.
+    ///
+    ///     const BaseXX::CustomAlphabet bcrypt{
+    ///         "./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+    ///         "0123456789", BaseXX::ePadding::None };
+    ///     std::string salt = bcrypt.encode(bytes);
+    /// ========================================================================
+
+    class CustomAlphabet
+    {
+    public:
+        /// `chars` lists the characters of the alphabet in value order:
+        /// printable ASCII but '=', each one once. `aliases` lists pairs of
+        /// an extra character accepted on input and the character of the
+        /// alphabet it stands for, e.g. "O0o0I1i1L1l1" in Crockford's
+        /// Base32. `padding` applies to every call. Throws InvalidAlphabet
+        /// when check() fails.
+        explicit CustomAlphabet(StringType chars,
+            const ePadding padding = ePadding::Required,
+            StringType aliases = "")
+            : padding_{ padding }
+        {
+            DecodeTable table{};
+            if (!make_table(chars, aliases, table))
+            {
+                throwRuntimeError(eResultCode::InvalidAlphabet, __FUNCTION__);
+            }
+
+            bits_ = (chars.size() == 64) ? 6 : (chars.size() == 32) ? 5 : 4;
+            memcpy(encoding_, chars.data(), chars.size());
+            lut_ = make_nibble_lut(table);
+        }
+
+        /// InvalidAlphabet for the arguments the constructor rejects.
+        static eResultCode check(StringType chars, StringType aliases = "")
+        {
+            DecodeTable table{};
+            return make_table(chars, aliases, table)
+                ? eResultCode::Success : eResultCode::InvalidAlphabet;
+        }
+
+        size_t bits_per_char() const { return bits_; }
+        size_t size() const { return size_t{ 1 } << bits_; }
+        ePadding padding() const { return padding_; }
+        const uint8_t* encoding() const { return encoding_; }
+        const DecodeTable& decoding() const { return lut_.table; }
+
+        /// Value of a character, or invalid_value outside the alphabet.
+        uint8_t decode_value(const char c) const noexcept
+        {
+            return lut_.table(c);
+        }
+
+        size_t encoded_length(const size_t data_len) const
+        {
+            switch (bits_)
+            {
+            case 6:
+                return Geometry<6>::encoded_length(data_len, padding_);
+            case 5:
+                return Geometry<5>::encoded_length(data_len, padding_);
+            default:
+                return Geometry<4>::encoded_length(data_len, padding_);
+            }
+        }
+
+        size_t decoded_length(
+            const char* encoded_text, const size_t text_len) const
+        {
+            switch (bits_)
+            {
+            case 6:
+                return Geometry<6>::decoded_length(encoded_text, text_len);
+            case 5:
+                return Geometry<5>::decoded_length(encoded_text, text_len);
+            default:
+                return Geometry<4>::decoded_length(encoded_text, text_len);
+            }
+        }
+
+        eResultCode check_format(
+            const char* encoded_text, const size_t text_len) const
+        {
+            switch (bits_)
+            {
+            case 6:
+                return Geometry<6>::check_format(
+                    encoded_text, text_len, padding_);
+            case 5:
+                return Geometry<5>::check_format(
+                    encoded_text, text_len, padding_);
+            default:
+                return Geometry<4>::check_format(
+                    encoded_text, text_len, padding_);
+            }
+        }
+
+        /// Encode into caller memory; returns the number of characters
+        /// written.
+        size_t encode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len) const
+        {
+            const uint8_t* const table = encoding_;
+            switch (bits_)
+            {
+            case 6:
+                return encode_groups<6>(dst, dst_cap, data, data_len,
+                    table, padding_,
+                    [table](const uint8_t* src, const size_t src_len, char* out)
+                    {
+                        return _64_::encode_words(src, src_len, out, table);
+                    });
+            case 5:
+                return encode_groups<5>(dst, dst_cap, data, data_len,
+                    table, padding_,
+                    [table](const uint8_t* src, const size_t src_len, char* out)
+                    {
+                        return _32_::encode_words(src, src_len, out, table);
+                    });
+            default:
+                return encode_groups<4>(dst, dst_cap, data, data_len,
+                    table, padding_,
+                    [table](const uint8_t* src, const size_t src_len, char* out)
+                    {
+                        return _16_::encode_words(src, src_len, out, table);
+                    });
+            }
+        }
+
+        /// Decode into caller memory without throwing. On failure the result
+        /// holds the offset of the first offending character and the number
+        /// of bytes decoded in front of it.
+        DecodeResult try_decode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len) const
+        {
+            const NibbleLut& lut = lut_;
+            switch (bits_)
+            {
+            case 6:
+                return decode_groups<6>(dst, dst_cap, data, data_len,
+                    lut.table, padding_,
+                    [&lut](const char* src, const size_t src_len, char* out)
+                    {
+                        return _64_::kernels().decode_custom(
+                            src, src_len, out, lut);
+                    });
+            case 5:
+                return decode_groups<5>(dst, dst_cap, data, data_len,
+                    lut.table, padding_,
+                    [&lut](const char* src, const size_t src_len, char* out)
+                    {
+                        return _32_::kernels().decode_custom(
+                            src, src_len, out, lut);
+                    });
+            default:
+                return decode_groups<4>(dst, dst_cap, data, data_len,
+                    lut.table, padding_,
+                    [&lut](const char* src, const size_t src_len, char* out)
+                    {
+                        return _16_::kernels().decode_custom(
+                            src, src_len, out, lut);
+                    });
+            }
+        }
+
+        /// Decode into caller memory; returns the number of bytes written.
+        size_t decode_into(char* dst, const size_t dst_cap,
+            const char* data, const size_t data_len) const
+        {
+            const DecodeResult result =
+                try_decode_into(dst, dst_cap, data, data_len);
+            if (!result)
+            {
+                throwDecodeError(result, __FUNCTION__);
+            }
+
+            return result.written;
+        }
+
+        /// The checks of try_decode_into(); on success `written` is the
+        /// length a decode would write.
+        DecodeResult validate(const char* data, const size_t data_len) const
+        {
+            const NibbleLut& lut = lut_;
+            const auto bulk = [&lut](const char* src, const size_t src_len)
+            {
+                return validate_custom(src, src_len, lut);
+            };
+
+            switch (bits_)
+            {
+            case 6:
+                return validate_groups<6>(
+                    data, data_len, lut.table, padding_, bulk);
+            case 5:
+                return validate_groups<5>(
+                    data, data_len, lut.table, padding_, bulk);
+            default:
+                return validate_groups<4>(
+                    data, data_len, lut.table, padding_, bulk);
+            }
+        }
+
+        bool is_valid(const ByteView text) const
+        {
+            return static_cast<bool>(validate(text.data(), text.size()));
+        }
+
+        std::string encode(const ByteView bytes) const
+        {
+            std::string encoded(encoded_length(bytes.size()), '\0');
+            encode_into(&encoded[0], encoded.size(),
+                bytes.data(), bytes.size());
+
+            return encoded;
+        }
+
+        std::string decode(const ByteView text) const
+        {
+            std::string decoded(
+                decoded_length(text.data(), text.size()), '\0');
+            decoded.resize(decode_into(&decoded[0], decoded.size(),
+                text.data(), text.size()));
+
+            return decoded;
+        }
+
+    private:
+        /// Printable ASCII but '=', which stands for the padding.
+        static constexpr bool is_alphabet_char(const char c)
+        {
+            return c > ' ' && c < 0x7F && c != '=';
+        }
+
+        static bool make_table(
+            StringType chars, StringType aliases, DecodeTable& table)
+        {
+            const size_t size = chars.size();
+            if ((size != 16 && size != 32 && size != 64) ||
+                aliases.size() % 2 != 0)
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < 256; i++)
+            {
+                table.values[i] = invalid_value;
+            }
+            for (size_t i = 0; i < size; i++)
+            {
+                if (!is_alphabet_char(chars[i]) ||
+                    table(chars[i]) != invalid_value)
+                {
+                    return false;
+                }
+                table.values[static_cast<uint8_t>(chars[i])] =
+                    static_cast<uint8_t>(i);
+            }
+            for (size_t i = 0; i < aliases.size(); i += 2)
+            {
+                const char alias = aliases[i];
+                const char target = aliases[i + 1];
+                if (!is_alphabet_char(alias) ||
+                    table(alias) != invalid_value ||
+                    chars.find(target) == chars.npos)
+                {
+                    return false;
+                }
+                table.values[static_cast<uint8_t>(alias)] = table(target);
+            }
+
+            return true;
+        }
+
+        size_t bits_ = 6;
+        ePadding padding_ = ePadding::Required;
+        uint8_t encoding_[64] = { 0, };
+        NibbleLut lut_{};
+    };
 }  // namespace BaseXX
 
 namespace base64 = ::BaseXX::_64_;
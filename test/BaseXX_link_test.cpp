@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+
+#include "BaseXX.h"
+
+// A second translation unit including BaseXX.h. Each one has its own copy
+// of the namespace-scope tables, while the linker keeps a single copy of
+// every inline kernel: whichever unit that copy came from, the kernels must
+// behave the same in both.
+
+TEST(Link, second_translation_unit)
+{
+    const BaseXX::eSimdLevel saved{ BaseXX::simd_level() };
+    for (const auto level : { BaseXX::eSimdLevel::Scalar,
+        BaseXX::eSimdLevel::SSE41, BaseXX::eSimdLevel::AVX2 })
+    {
+        if (level > BaseXX::max_simd_level())
+        {
+            break;
+        }
+
+        SCOPED_TRACE(BaseXX::simd_level_name(level));
+        BaseXX::set_simd_level(level);
+
+        std::string bytes{};
+        for (size_t len = 0; len <= 100; len++)
+        {
+            SCOPED_TRACE(len);
+
+            ASSERT_EQ(bytes, base64::decode(base64::encode(bytes)));
+            ASSERT_EQ(bytes,
+                base64::decode_urlsafe(base64::encode_urlsafe(bytes)));
+            ASSERT_TRUE(
+                base64::is_valid_urlsafe(base64::encode_urlsafe(bytes)));
+            ASSERT_EQ(bytes, base32::decode(base32::encode(bytes)));
+            ASSERT_EQ(bytes, base32::decode_hex(base32::encode_hex(bytes)));
+            ASSERT_TRUE(base32::is_valid_hex(base32::encode_hex(bytes)));
+            ASSERT_EQ(bytes, base16::decode(base16::encode(bytes)));
+            ASSERT_EQ(bytes,
+                base16::decode_any_case(base16::encode_lower(bytes)));
+
+            base64::Decoder decoder{ base64::urlsafe_encoding_table };
+            ASSERT_EQ(bytes, decoder.update(base64::encode_urlsafe(bytes)));
+            decoder.finalize();
+
+            bytes.push_back(static_cast<char>(len * 37 + 11));
+        }
+
+        ASSERT_EQ("\xFB\xFF", base64::decode_urlsafe("-_8="));
+        ASSERT_EQ("foobar", base32::decode_hex("CPNMUOJ1E8======"));
+    }
+    BaseXX::set_simd_level(saved);
+}  // TEST(Link, second_translation_unit)
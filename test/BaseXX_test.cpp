@@ -1,7 +1,174 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#if __cplusplus >= 201703L && __has_include(<memory_resource>)
+#include <memory_resource>
+#define BASEXX_TEST_PMR
+#endif
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#define BASEXX_TEST_SPAN
+#endif
+
 #include "BaseXX.h"
 
+namespace
+{
+    /// Deterministic pseudo-random bytes (xorshift32)
+    std::string make_bytes(size_t len, uint32_t seed = 0x9E3779B9u)
+    {
+        std::string bytes(len, '\0');
+        for (auto& c : bytes)
+        {
+            seed ^= seed << 13;
+            seed ^= seed >> 17;
+            seed ^= seed << 5;
+            c = static_cast<char>(seed & 0xFF);
+        }
+
+        return bytes;
+    }
+
+    /// Bit-by-bit reference encoder used to cross-check the fast paths.
+    std::string reference_encode(
+        const std::string& data, const uint8_t* table, size_t bits)
+    {
+        const size_t group = (bits == 6) ? 4 : (bits == 5) ? 8 : 2;
+
+        std::string encoded{};
+        uint32_t acc = 0;
+        size_t acc_bits = 0;
+        for (const auto& c : data)
+        {
+            acc = (acc << 8) | static_cast<uint8_t>(c);
+            acc_bits += 8;
+            while (acc_bits >= bits)
+            {
+                acc_bits -= bits;
+                encoded.push_back(
+                    table[(acc >> acc_bits) & ((1u << bits) - 1)]);
+            }
+        }
+        if (acc_bits)
+        {
+            encoded.push_back(
+                table[(acc << (bits - acc_bits)) & ((1u << bits) - 1)]);
+        }
+        while (encoded.size() % group != 0)
+        {
+            encoded.push_back('=');
+        }
+
+        return encoded;
+    }
+
+    /// Run `test` once per SIMD level this CPU supports.
+    template <typename Test>
+    void for_each_simd_level(Test test)
+    {
+        const BaseXX::eSimdLevel saved{ BaseXX::simd_level() };
+        for (const auto level : { BaseXX::eSimdLevel::Scalar,
+            BaseXX::eSimdLevel::SSE41, BaseXX::eSimdLevel::AVX2,
+            BaseXX::eSimdLevel::AVX512BW })
+        {
+            if (level > BaseXX::max_simd_level())
+            {
+                break;
+            }
+
+            SCOPED_TRACE(BaseXX::simd_level_name(level));
+            BaseXX::set_simd_level(level);
+            test();
+        }
+        BaseXX::set_simd_level(saved);
+    }
+
+    /// `text` with each of `chars` at every offset in turn, then after it.
+    std::vector<std::string> corruptions(
+        const std::string& text, const std::string& chars)
+    {
+        std::vector<std::string> corrupted{};
+        for (const auto c : chars)
+        {
+            for (size_t pos = 0; pos <= text.size(); pos++)
+            {
+                corrupted.push_back(text);
+                if (pos < text.size())
+                {
+                    corrupted.back()[pos] = c;
+                }
+                else
+                {
+                    corrupted.back().push_back(c);
+                }
+            }
+        }
+
+        return corrupted;
+    }
+
+    /// Allocator that counts the bytes it hands out, standing in for an arena.
+    template <typename T>
+    struct CountingAllocator
+    {
+        using value_type = T;
+
+        size_t* allocated;
+
+        explicit CountingAllocator(size_t* counter) : allocated{ counter } {}
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U>& other)
+            : allocated{ other.allocated } {}
+
+        T* allocate(const size_t n)
+        {
+            *allocated += n * sizeof(T);
+            return std::allocator<T>{}.allocate(n);
+        }
+        void deallocate(T* p, const size_t n)
+        {
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template <typename U>
+        bool operator==(const CountingAllocator<U>& other) const
+        {
+            return allocated == other.allocated;
+        }
+        template <typename U>
+        bool operator!=(const CountingAllocator<U>& other) const
+        {
+            return allocated != other.allocated;
+        }
+    };
+
+    using counted_string = std::basic_string<
+        char, std::char_traits<char>, CountingAllocator<char>>;
+    using counted_bytes = std::vector<uint8_t, CountingAllocator<uint8_t>>;
+
+    /// 3 bits per character: an alphabet the Codec engine has no kernels
+    /// for, running on its scalar loops alone.
+    constexpr uint8_t octal_table[8] = {
+        '0', '1', '2', '3', '4', '5', '6', '7',
+    };
+    constexpr BaseXX::DecodeTable octal_decode_table =
+        BaseXX::make_decode_table(octal_table);
+
+    struct OctalAlphabet : BaseXX::ScalarPlugin
+    {
+        static const uint8_t* encoding() { return octal_table; }
+        static const BaseXX::DecodeTable& decoding()
+        {
+            return octal_decode_table;
+        }
+    };
+}  // namespace
+
 TEST(Base64, encode)
 {
     ASSERT_EQ("", base64::encode(""));
@@ -82,6 +249,23 @@ TEST(Base64, encode_urlsafe)
     }
 }  // TEST(Base64, encode_urlsafe)
 
+TEST(Base64, encode_long)
+{
+    for_each_simd_level([]()
+    {
+        for (size_t len = 0; len < 300; len++)
+        {
+            const std::string data{
+                make_bytes(len, static_cast<uint32_t>(len + 1)) };
+            ASSERT_EQ(reference_encode(data, base64::encoding_table, 6),
+                base64::encode(data)) << "len: " << len;
+            ASSERT_EQ(
+                reference_encode(data, base64::urlsafe_encoding_table, 6),
+                base64::encode_urlsafe(data)) << "len: " << len;
+        }
+    });
+}  // TEST(Base64, encode_long)
+
 TEST(Base64, decode)
 {
     ASSERT_EQ("", base64::decode(""));
@@ -204,6 +388,984 @@ TEST(Base64, decode_urlsafe)
     }
 }  // TEST(Base64, decode_urlsafe)
 
+TEST(Base64, decode_long)
+{
+    for_each_simd_level([]()
+    {
+        for (size_t len = 0; len < 300; len++)
+        {
+            const std::string data{
+                make_bytes(len, static_cast<uint32_t>(len + 1)) };
+            ASSERT_EQ(data, base64::decode(base64::encode(data)))
+                << "len: " << len;
+            ASSERT_EQ(data,
+                base64::decode_urlsafe(base64::encode_urlsafe(data)))
+                << "len: " << len;
+        }
+
+        {  // every invalid character at every position of a long text
+            const std::string encoded{ base64::encode(make_bytes(150)) };
+            const std::string urlsafe_encoded{
+                base64::encode_urlsafe(make_bytes(150)) };
+            for (int c = 0; c < 256; c++)
+            {
+                const char ch = static_cast<char>(c);
+                // '=' ends the text early instead of being rejected
+                const bool valid =
+                    (std::isalnum(c) != 0 && c < 128) || c == '=';
+                for (size_t pos = 0; pos < encoded.size() - 4; pos += 7)
+                {
+                    std::string text{ encoded };
+                    text[pos] = ch;
+                    if (!valid && ch != '+' && ch != '/')
+                    {
+                        ASSERT_THROW(base64::decode(text), std::runtime_error)
+                            << "char: " << c << ", pos: " << pos;
+                    }
+
+                    std::string urlsafe_text{ urlsafe_encoded };
+                    urlsafe_text[pos] = ch;
+                    if (!valid && ch != '-' && ch != '_')
+                    {
+                        ASSERT_THROW(base64::decode_urlsafe(urlsafe_text),
+                            std::runtime_error)
+                            << "char: " << c << ", pos: " << pos;
+                    }
+                }
+            }
+        }
+    });
+}  // TEST(Base64, decode_long)
+
+TEST(Base64, into_append)
+{
+    static_assert(base64::encoded_length(0) == 0, "");
+    static_assert(base64::encoded_length(1) == 4, "");
+    static_assert(base64::encoded_length(3) == 4, "");
+    static_assert(base64::encoded_length(4) == 8, "");
+    static_assert(base64::decoded_length("YUE=", 4) == 2, "");
+    ASSERT_EQ(0u, base64::decoded_length("", 0));
+    ASSERT_EQ(1u, base64::decoded_length("XA==", 4));
+    ASSERT_EQ(3u, base64::decoded_length("7ZWc", 4));
+    ASSERT_EQ(4u, base64::decoded_length("XG5cMA==", 8));
+
+    {  // encode_into & decode_into
+        char buf[16] = { 0, };
+        ASSERT_EQ(8u, base64::encode_into(buf, sizeof(buf), "\\n\\0", 4));
+        ASSERT_EQ("XG5cMA==", std::string(buf, 8));
+        ASSERT_EQ(4u, base64::encode_urlsafe_into(buf, 4, "\xff\xff\xff", 3));
+        ASSERT_EQ("____", std::string(buf, 4));
+        ASSERT_THROW(base64::encode_into(buf, 7, "\\n\\0", 4),
+            std::runtime_error);
+
+        ASSERT_EQ(4u, base64::decode_into(buf, 4, "XG5cMA==", 8));
+        ASSERT_EQ("\\n\\0", std::string(buf, 4));
+        ASSERT_EQ(3u, base64::decode_urlsafe_into(buf, 3, "____", 4));
+        ASSERT_EQ("\xff\xff\xff", std::string(buf, 3));
+        ASSERT_THROW(base64::decode_into(buf, 3, "XG5cMA==", 8),
+            std::runtime_error);
+        ASSERT_EQ(0u, base64::decode_into(buf, 0, "", 0));
+    }
+
+    {  // append
+        std::string out{ "data:" };
+        base64::encode_append(out, "\\n", 2);
+        ASSERT_EQ("data:XG4=", out);
+        base64::encode_urlsafe_append(out, "\xff\xff\xff", 3);
+        ASSERT_EQ("data:XG4=____", out);
+
+        out = "raw:";
+        base64::decode_append(out, "XG4=", 4);
+        ASSERT_EQ("raw:\\n", out);
+        base64::decode_urlsafe_append(out, "____", 4);
+        ASSERT_EQ("raw:\\n\xff\xff\xff", out);
+        ASSERT_THROW(base64::decode_append(out, "_/_/", 4),
+            std::runtime_error);
+        ASSERT_EQ("raw:\\n\xff\xff\xff", out);
+    }
+}  // TEST(Base64, into_append)
+
+TEST(Base64, Encoder)
+{
+    const std::string data{ make_bytes(1000) };
+    for (size_t chunk = 1; chunk < 40; chunk++)
+    {
+        base64::Encoder encoder{};
+        base64::Encoder urlsafe_encoder{ base64::urlsafe_encoding_table };
+        std::string encoded{};
+        std::string urlsafe_encoded{};
+        for (size_t pos = 0; pos < data.size(); pos += chunk)
+        {
+            const std::string piece{ data.substr(pos, chunk) };
+            encoder.update(piece.data(), piece.size(), encoded);
+            urlsafe_encoded += urlsafe_encoder.update(piece);
+        }
+        encoder.finalize(encoded);
+        urlsafe_encoded += urlsafe_encoder.finalize();
+
+        ASSERT_EQ(base64::encode(data), encoded) << "chunk: " << chunk;
+        ASSERT_EQ(base64::encode_urlsafe(data), urlsafe_encoded)
+            << "chunk: " << chunk;
+    }
+
+    {  // output is produced as soon as a group is complete
+        base64::Encoder encoder{};
+        ASSERT_EQ("", encoder.update("a"));
+        ASSERT_EQ("", encoder.update("A"));
+        ASSERT_EQ("YUFi", encoder.update("bB"));
+        ASSERT_EQ("QkJjQ2RE", encoder.update("BcCdDe"));
+        ASSERT_EQ("ZQ==", encoder.finalize());
+        ASSERT_EQ("", encoder.finalize());
+
+        char buf[4] = { 0, };
+        ASSERT_EQ(0u, encoder.update_into(buf, 0, "ab", 2));
+        ASSERT_THROW(encoder.update_into(buf, 3, "c", 1), std::runtime_error);
+    }
+}  // TEST(Base64, Encoder)
+
+TEST(Base64, Decoder)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(1001) };
+        const std::string encoded{ base64::encode(data) };
+        const std::string urlsafe_encoded{ base64::encode_urlsafe(data) };
+        for (size_t chunk = 1; chunk < 40; chunk++)
+        {
+            base64::Decoder decoder{};
+            base64::Decoder urlsafe_decoder{ base64::urlsafe_encoding_table };
+            std::string decoded{};
+            std::string urlsafe_decoded{};
+            for (size_t pos = 0; pos < encoded.size(); pos += chunk)
+            {
+                const std::string piece{ encoded.substr(pos, chunk) };
+                decoder.update(piece.data(), piece.size(), decoded);
+                urlsafe_decoded +=
+                    urlsafe_decoder.update(urlsafe_encoded.substr(pos, chunk));
+            }
+            decoder.finalize();
+            urlsafe_decoder.finalize();
+
+            ASSERT_EQ(data, decoded) << "chunk: " << chunk;
+            ASSERT_EQ(data, urlsafe_decoded) << "chunk: " << chunk;
+        }
+
+        // An invalid character is reported at its absolute offset
+        std::string corrupted{ encoded };
+        corrupted[777] = '*';
+        base64::Decoder decoder{};
+        std::string decoded{};
+        decoder.update(corrupted.data(), 512, decoded);
+        ASSERT_EQ(384u, decoded.size());
+        try
+        {
+            decoder.update(corrupted.data() + 512, 512, decoded);
+            FAIL() << "expected an exception";
+        }
+        catch (const std::runtime_error& e)
+        {
+            ASSERT_NE(std::string::npos,
+                std::string(e.what()).find("(offset: 777)")) << e.what();
+        }
+    });
+
+    base64::Decoder decoder{};
+    ASSERT_EQ("", decoder.update("YU"));
+    ASSERT_EQ("aAb", decoder.update("FiQk"));
+    ASSERT_EQ(6u, decoder.offset());
+    ASSERT_EQ("", decoder.update("I"));
+    ASSERT_THROW(decoder.finalize(), std::runtime_error);  // incomplete
+    ASSERT_EQ(0u, decoder.offset());
+
+    ASSERT_EQ("aA", decoder.update("YUE="));
+    ASSERT_THROW(decoder.update("YQ=="), std::runtime_error);  // after pad
+    decoder.reset();
+    ASSERT_THROW(decoder.update("Y==="), std::runtime_error);
+    decoder.reset();
+    ASSERT_THROW(decoder.update("YQ=a"), std::runtime_error);
+
+    // A failing update() leaves `out` as it was
+    decoder.reset();
+    std::string out{ "X" };
+    ASSERT_THROW(decoder.update("Zm9vYmFy!!!!Zm9v", 16, out),
+        std::runtime_error);
+    ASSERT_EQ("X", out);
+}  // TEST(Base64, Decoder)
+
+TEST(Base64, try_decode)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(500) };
+        std::string encoded{ base64::encode(data) };
+        std::string out{};
+
+        BaseXX::DecodeResult result{ base64::try_decode(encoded, out) };
+        ASSERT_TRUE(result);
+        ASSERT_EQ(data.size(), result.written);
+        ASSERT_EQ(data, out);
+
+        encoded[301] = '-';
+        result = base64::try_decode(encoded, out);
+        ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+        ASSERT_EQ(301u, result.offset);
+        ASSERT_EQ(300u / 4 * 3, result.written);
+        ASSERT_EQ(data.substr(0, result.written), out);
+
+        result = base64::try_decode_urlsafe(encoded, out);
+        ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+
+        // Nothing is stored for the characters from the offending one on.
+        encoded = base64::encode(data.substr(0, 300));
+        for (size_t bad = 0; bad < encoded.size(); bad++)
+        {
+            SCOPED_TRACE(bad);
+            std::string text{ encoded };
+            text[bad] = '*';
+            std::string buf(300, '\xA5');
+            result = base64::try_decode_into(
+                &buf[0], buf.size(), text.data(), text.size());
+            ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+            ASSERT_EQ(bad, result.offset);
+            ASSERT_EQ(bad / 4 * 3, result.written);
+            ASSERT_EQ(data.substr(0, result.written),
+                buf.substr(0, result.written));
+            ASSERT_EQ(std::string(300 - result.written, '\xA5'),
+                buf.substr(result.written));
+        }
+    });
+
+    std::string out{ "untouched" };
+    BaseXX::DecodeResult result{ base64::try_decode("YWJjZA=", out) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(4u, result.offset);
+    ASSERT_EQ("", out);
+
+    result = base64::try_decode("YW===", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    result = base64::try_decode("YWJj====", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(4u, result.offset);
+
+    ASSERT_TRUE(base64::try_decode_urlsafe("7ZWc", out));
+    ASSERT_EQ("한", out);
+    ASSERT_TRUE(base64::try_decode("", out));
+    ASSERT_EQ("", out);
+
+    char buf[3] = { 0, };
+    result = base64::try_decode_into(buf, 2, "7ZWc", 4);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidBufferSize, result.code);
+    result = base64::try_decode_urlsafe_into(buf, 3, "7ZWc", 4);
+    ASSERT_TRUE(result);
+    ASSERT_EQ("한", std::string(buf, result.written));
+
+    try
+    {
+        base64::decode("YWJj*A==");
+        FAIL() << "expected an exception";
+    }
+    catch (const std::runtime_error& e)
+    {
+        ASSERT_NE(std::string::npos,
+            std::string(e.what()).find("(offset: 4)")) << e.what();
+    }
+}  // TEST(Base64, try_decode)
+
+TEST(Base64, alphabet)
+{
+    static_assert(base64::decode_table('A') == 0, "");
+    static_assert(base64::decode_table('/') == 63, "");
+    static_assert(base64::decode_table('-') == BaseXX::invalid_value, "");
+    static_assert(base64::urlsafe_decode_table('-') == 62, "");
+    static_assert(base64::decode_value('=') == BaseXX::invalid_value, "");
+
+    const std::string data{ make_bytes(100) };
+    const std::string encoded{
+        base64::encode_base<base64::UrlSafeAlphabet>(data.data(), data.size())
+    };
+    ASSERT_EQ(base64::encode_urlsafe(data), encoded);
+    ASSERT_EQ(data, base64::decode_base<base64::UrlSafeAlphabet>(
+        encoded.data(), encoded.size()));
+    ASSERT_THROW(base64::decode_base<base64::StandardAlphabet>(
+        encoded.data(), encoded.size()), std::runtime_error);
+
+    // A caller-supplied lookup still goes through the generic loop
+    uint8_t (*lookup)(const char) = [](const char c)
+    {
+        return base64::decode_char((c == '.') ? '/' : c);
+    };
+    ASSERT_EQ("\xFF\xFF", base64::decode_base("//8=", 4, lookup));
+    ASSERT_EQ("\xFF\xFF", base64::decode_base("..8=", 4, lookup));
+    ASSERT_THROW(base64::decode_base("-38=", 4, lookup), std::runtime_error);
+}  // TEST(Base64, alphabet)
+
+TEST(Base64, parallel)
+{
+    const std::string data{ make_bytes(3 * BaseXX::parallel_min_slice + 7) };
+    const std::string encoded{ base64::encode(data) };
+    const std::string urlsafe_encoded{ base64::encode_urlsafe(data) };
+
+    for (size_t threads : { 1, 2, 3, 4 })
+    {
+        ASSERT_EQ(encoded,
+            base64::encode_parallel(data.data(), data.size(), threads));
+        ASSERT_EQ(urlsafe_encoded,
+            base64::encode_parallel(data.data(), data.size(), threads,
+                base64::urlsafe_encoding_table));
+        ASSERT_EQ(data,
+            base64::decode_parallel(encoded.data(), encoded.size(), threads));
+        ASSERT_EQ(data,
+            base64::decode_parallel(urlsafe_encoded.data(),
+                urlsafe_encoded.size(), threads,
+                &base64::urlsafe_decode_char));
+    }
+
+    // Small inputs stay on the calling thread
+    ASSERT_EQ("YWJj", base64::encode_parallel("abc", 3, 8));
+    ASSERT_EQ("abc", base64::decode_parallel("YWJj", 4, 8));
+
+    // Errors match the serial decoder, wherever the slices fall
+    std::string corrupted{ encoded };
+    corrupted[corrupted.size() / 2 + 1] = '*';
+    std::string serial(encoded.size(), '\0');
+    std::string parallel(encoded.size(), '\0');
+    BaseXX::DecodeResult expected = base64::try_decode_into(&serial[0],
+        serial.size(), corrupted.data(), corrupted.size());
+    BaseXX::DecodeResult result = base64::try_decode_parallel_into(
+        &parallel[0], parallel.size(), corrupted.data(), corrupted.size(), 4);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(expected.offset, result.offset);
+    ASSERT_EQ(expected.written, result.written);
+
+    ASSERT_THROW(base64::decode_parallel(
+        corrupted.data(), corrupted.size(), 4), std::runtime_error);
+
+    // Padding inside a slice ends the text there, as it does serially
+    corrupted = encoded;
+    corrupted.replace(encoded.size() / 4 * 2, 4, "QQ==");
+    expected = base64::try_decode_into(&serial[0],
+        serial.size(), corrupted.data(), corrupted.size());
+    result = base64::try_decode_parallel_into(
+        &parallel[0], parallel.size(), corrupted.data(), corrupted.size(), 4);
+    ASSERT_EQ(expected.code, result.code);
+    ASSERT_EQ(expected.written, result.written);
+    ASSERT_EQ(serial.substr(0, expected.written),
+        parallel.substr(0, result.written));
+    ASSERT_THROW(base64::encode_parallel_into(
+        &parallel[0], 10, data.data(), data.size(), 4), std::runtime_error);
+}  // TEST(Base64, parallel)
+
+TEST(Base64, batch)
+{
+    BaseXX::Column column{};
+    for (size_t len = 0; len < 70; len++)
+    {
+        const std::string value{ make_bytes(len, static_cast<uint32_t>(len)) };
+        column.push_back(value.data(), value.size());
+    }
+
+    const BaseXX::Column encoded{ base64::encode_batch(column) };
+    const BaseXX::Column urlsafe_encoded{
+        base64::encode_batch(column, base64::urlsafe_encoding_table) };
+    ASSERT_EQ(column.rows(), encoded.rows());
+    for (size_t row = 0; row < column.rows(); row++)
+    {
+        ASSERT_EQ(base64::encode(column.row(row)), encoded.row(row));
+        ASSERT_EQ(base64::encode_urlsafe(column.row(row)),
+            urlsafe_encoded.row(row));
+    }
+
+    BaseXX::Column reused{};
+    reused.push_back("stale", 5);
+    base64::encode_batch(column, reused);
+    ASSERT_EQ(encoded.data, reused.data);
+    ASSERT_EQ(encoded.offsets, reused.offsets);
+
+    ASSERT_EQ(column.data, base64::decode_batch(encoded).data);
+    ASSERT_EQ(column.offsets, base64::decode_batch(encoded).offsets);
+    ASSERT_EQ(column.data, base64::decode_batch(
+        urlsafe_encoded, &base64::urlsafe_decode_char).data);
+
+    // Bad rows are left empty and reported, the others are decoded
+    BaseXX::Column corrupted{};
+    corrupted.push_back("YWJj", 4);
+    corrupted.push_back("YW*j", 4);
+    corrupted.push_back("", 0);
+    corrupted.push_back("YWJ", 3);
+    corrupted.push_back("ZA==", 4);
+
+    BaseXX::Column decoded{};
+    std::vector<BaseXX::RowError> errors{};
+    ASSERT_EQ(2u, base64::try_decode_batch(corrupted, decoded, errors));
+    ASSERT_EQ("abcd", decoded.data);
+    ASSERT_EQ((std::vector<size_t>{ 0, 3, 3, 3, 3, 4 }), decoded.offsets);
+    ASSERT_EQ(2u, errors.size());
+    ASSERT_EQ(1u, errors[0].row);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, errors[0].result.code);
+    ASSERT_EQ(2u, errors[0].result.offset);
+    ASSERT_EQ(3u, errors[1].row);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, errors[1].result.code);
+    ASSERT_THROW(base64::decode_batch(corrupted), std::runtime_error);
+
+    // Caller-owned buffers
+    char dst[16] = { 0, };
+    size_t dst_offsets[6] = { 0, };
+    BaseXX::DecodeResult results[5]{};
+    ASSERT_EQ(2u, base64::try_decode_batch_into(dst, sizeof(dst),
+        dst_offsets, corrupted.data.data(), corrupted.offsets.data(),
+        corrupted.rows(), results));
+    ASSERT_TRUE(results[0]);
+    ASSERT_FALSE(results[1]);
+    ASSERT_EQ(1u, results[4].written);
+    ASSERT_EQ("abcd", std::string(dst, dst_offsets[5]));
+    ASSERT_THROW(base64::encode_batch_into(dst, 4, dst_offsets,
+        column.data.data(), column.offsets.data(), 3), std::runtime_error);
+}  // TEST(Base64, batch)
+
+TEST(Base64, allocator)
+{
+    size_t allocated = 0;
+    const CountingAllocator<char> alloc{ &allocated };
+
+    const counted_string encoded{
+        base64::encode<counted_string>("foob", alloc) };
+    ASSERT_EQ("Zm9vYg==", std::string(encoded.begin(), encoded.end()));
+
+    // The decode allocates through `alloc` as well
+    const size_t before_decode = allocated;
+    const counted_bytes decoded{
+        base64::decode<counted_bytes>("Zm9vYg==", alloc) };
+    ASSERT_LT(before_decode, allocated);
+    ASSERT_EQ("foob", std::string(decoded.begin(), decoded.end()));
+    ASSERT_EQ("___-", base64::encode_urlsafe<std::string>("\xff\xff\xfe"));
+    ASSERT_EQ("\xff\xff\xfe", base64::decode_urlsafe<std::string>("___-"));
+
+    counted_bytes out{ alloc };
+    base64::encode_append(out, "foob", 4);
+    ASSERT_EQ("Zm9vYg==", std::string(out.begin(), out.end()));
+    out.clear();
+    ASSERT_EQ(BaseXX::eResultCode::Success,
+        base64::try_decode("Zm9vYg==", out).code);
+    ASSERT_EQ("foob", std::string(out.begin(), out.end()));
+    ASSERT_THROW(base64::decode<counted_string>("!!!!!!!!", alloc),
+        std::runtime_error);
+
+#ifdef BASEXX_TEST_PMR
+    char arena_buf[4096];
+    std::pmr::monotonic_buffer_resource arena{ arena_buf, sizeof(arena_buf),
+        std::pmr::null_memory_resource() };
+    const std::pmr::string pmr_encoded{
+        base64::encode<std::pmr::string>(make_bytes(100), &arena) };
+    ASSERT_EQ(base64::encode(make_bytes(100)),
+        std::string(pmr_encoded.begin(), pmr_encoded.end()));
+    const std::pmr::vector<uint8_t> pmr_decoded{
+        base64::decode<std::pmr::vector<uint8_t>>(pmr_encoded, &arena) };
+    ASSERT_EQ(make_bytes(100),
+        std::string(pmr_decoded.begin(), pmr_decoded.end()));
+#endif
+}  // TEST(Base64, allocator)
+
+TEST(Base64, byte_range)
+{
+    const char* const cstr{ "foob" };
+    const std::array<uint8_t, 4> array{ { 'f', 'o', 'o', 'b' } };
+    const std::vector<uint8_t> vec(array.begin(), array.end());
+    ASSERT_EQ("Zm9vYg==", base64::encode(cstr));
+    ASSERT_EQ("Zm9vYg==", base64::encode({ cstr, 4 }));
+    ASSERT_EQ("Zm9vYg==", base64::encode(array));
+    ASSERT_EQ("Zm9vYg==", base64::encode(vec));
+    ASSERT_EQ("Zm9vYg==", base64::encode_urlsafe(array));
+    ASSERT_EQ("foob", base64::decode_urlsafe(std::string("Zm9vYg==")));
+
+    std::array<char, 8> encoded{};
+    ASSERT_EQ(8u, base64::encode_into(encoded, vec));
+    ASSERT_EQ("Zm9vYg==", std::string(encoded.begin(), encoded.end()));
+
+    std::array<uint8_t, 8> decoded{};
+    ASSERT_EQ(4u, base64::decode_into(decoded, encoded));
+    ASSERT_TRUE(std::equal(array.begin(), array.end(), decoded.begin()));
+    ASSERT_EQ(vec, base64::decode<std::vector<uint8_t>>(encoded));
+
+    std::array<uint8_t, 3> small{};
+    ASSERT_THROW(base64::decode_into(small, encoded), std::runtime_error);
+
+#if __cplusplus >= 201703L
+    const std::vector<std::byte> bytes{
+        reinterpret_cast<const std::byte*>(cstr),
+        reinterpret_cast<const std::byte*>(cstr) + 4 };
+    ASSERT_EQ("Zm9vYg==", base64::encode(bytes));
+    ASSERT_EQ("Zm9vYg==", base64::encode(std::string_view{ cstr, 4 }));
+    ASSERT_EQ(bytes, base64::decode<std::vector<std::byte>>("Zm9vYg=="));
+#endif
+#ifdef BASEXX_TEST_SPAN
+    ASSERT_EQ("Zm9vYg==", base64::encode(std::span<const uint8_t>{ vec }));
+    ASSERT_EQ(vec,
+        base64::decode<std::vector<uint8_t>>(std::span<const char>{ encoded }));
+#endif
+}  // TEST(Base64, byte_range)
+
+TEST(Base64, literal)
+{
+    constexpr auto encoded = base64::encode_literal("foobar!");
+    static_assert(encoded.size() == 12, "");
+    static_assert(encoded[9] == 'Q' && encoded[11] == '=', "");
+    constexpr auto decoded = base64::decode_literal("Zm9vYmFyIQ==");
+    static_assert(decoded.size() == 7 && decoded[6] == '!', "");
+    constexpr std::array<uint8_t, 3> bytes{ { 0xFF, 0xFF, 0xFE } };
+    constexpr auto urlsafe =
+        base64::encode_literal<base64::UrlSafeAlphabet>(bytes);
+    static_assert(urlsafe[0] == '_' && urlsafe[3] == '-', "");
+
+    ASSERT_EQ("Zm9vYmFyIQ==", std::string(encoded.begin(), encoded.end()));
+    ASSERT_EQ("foobar!", std::string(decoded.begin(), decoded.end()));
+    ASSERT_EQ("", base64::encode(base64::decode_literal("")));
+    ASSERT_EQ("Zg==", base64::encode(base64::decode_literal("Zg==")));
+    ASSERT_EQ("Zm8=", base64::encode(base64::decode_literal("Zm8=")));
+    ASSERT_EQ(base64::encode_urlsafe(bytes),
+        std::string(urlsafe.begin(), urlsafe.end()));
+
+    // Outside constant expressions malformed text throws like decode()
+    const char bad_char[] = "Zm9v!mFy";
+    const char bad_padding[] = "Zm9vY===";
+    const char bad_length[] = "Zm9vYg=";
+    const char inner_padding[] = "Zg==Zg==";
+    const char padded_group[] = "AAAA====";
+    const char only_padding[] = "====";
+    ASSERT_THROW(base64::decode_literal(bad_char), std::runtime_error);
+    ASSERT_THROW(base64::decode_literal(bad_padding), std::runtime_error);
+    ASSERT_THROW(base64::decode_literal(bad_length), std::runtime_error);
+    ASSERT_THROW(base64::decode_literal(inner_padding), std::runtime_error);
+    ASSERT_THROW(base64::decode_literal(padded_group), std::runtime_error);
+    ASSERT_THROW(base64::decode_literal(only_padding), std::runtime_error);
+}  // TEST(Base64, literal)
+
+TEST(Base64, wrapped)
+{
+    const auto wrap_lines = [](const std::string& encoded,
+        const base64::LineWrap& wrap)
+    {
+        std::string wrapped{};
+        for (size_t pos = 0; pos < encoded.size(); pos += wrap.line_len)
+        {
+            if (pos != 0)
+            {
+                wrapped += wrap.line_end;
+            }
+            wrapped += encoded.substr(pos, wrap.line_len);
+        }
+        if (wrap.end_last_line && !encoded.empty())
+        {
+            wrapped += wrap.line_end;
+        }
+
+        return wrapped;
+    };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(1000) };
+        const base64::LineWrap short_wrap{ 4, "|", false };
+        const base64::LineWrap odd_wrap{ 20, "\r\n", true };
+        for (size_t len = 0; len <= 500; len += (len < 130) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            const std::string encoded{ base64::encode(bytes) };
+            for (const auto& wrap :
+                { base64::mime_wrap, base64::pem_wrap, short_wrap, odd_wrap })
+            {
+                const std::string wrapped{
+                    base64::encode_wrapped(bytes, wrap) };
+                ASSERT_EQ(wrap_lines(encoded, wrap), wrapped);
+                ASSERT_EQ(wrapped.size(),
+                    base64::wrapped_length(bytes.size(), wrap));
+            }
+
+            std::string urlsafe{ ">" };
+            base64::encode_wrapped_append(urlsafe, bytes.data(),
+                bytes.size(), base64::pem_wrap, base64::urlsafe_encoding_table);
+            ASSERT_EQ('>', urlsafe[0]);
+            ASSERT_EQ(wrap_lines(base64::encode_urlsafe(bytes),
+                base64::pem_wrap), urlsafe.substr(1));
+        }
+    });
+
+    ASSERT_EQ("Zm9vYg==",
+        base64::encode_wrapped("foob", base64::LineWrap{ 0, "\n", true }));
+    ASSERT_THROW(base64::encode_wrapped("foob",
+        base64::LineWrap{ 70, "\n", false }), std::runtime_error);
+
+    char buf[16] = { 0, };
+    ASSERT_EQ(10u, base64::encode_wrapped_into(buf, sizeof(buf), "foob", 4,
+        base64::LineWrap{ 4, "\r\n", false }));
+    ASSERT_EQ("Zm9v\r\nYg==", std::string(buf, 10));
+    ASSERT_THROW(base64::encode_wrapped_into(buf, 9, "foob", 4,
+        base64::LineWrap{ 4, "\r\n", false }), std::runtime_error);
+}  // TEST(Base64, wrapped)
+
+TEST(Base64, lenient)
+{
+    const auto try_lenient = [](const std::string& text, std::string& out,
+        const BaseXX::eLenience lenience = BaseXX::eLenience::Whitespace)
+    {
+        return base64::try_decode_lenient(text.data(), text.size(), out,
+            lenience);
+    };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(10000) };
+        for (size_t len = 0; len <= 10000; len += (len < 130) ? 1 : 937)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            for (const auto& wrap : { base64::mime_wrap, base64::pem_wrap })
+            {
+                ASSERT_EQ(bytes, base64::decode_lenient(
+                    base64::encode_wrapped(bytes, wrap)));
+            }
+
+            std::string spaced{ base64::encode(bytes) };
+            for (size_t pos = spaced.size(); pos > 0; pos -= pos / 7 + 1)
+            {
+                spaced.insert(pos, (pos % 3 == 0) ? " \t" : "\n");
+            }
+            ASSERT_EQ(bytes, base64::decode_lenient(spaced));
+        }
+    });
+
+    ASSERT_EQ("", base64::decode_lenient(" \r\n"));
+    ASSERT_EQ("foob", base64::decode_lenient(" Zm 9v Yg = = \n"));
+    ASSERT_EQ("foob", base64::decode_lenient("Zm9vYg",
+        BaseXX::eLenience::Forgiving));
+    ASSERT_EQ("fooba", base64::decode_lenient("Zm9v\nYmE",
+        BaseXX::eLenience::Forgiving));
+
+    std::string out{ "untouched" };
+    BaseXX::DecodeResult result{ try_lenient("Zm9vYg", out) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(6u, result.offset);
+    ASSERT_EQ("foo", out);
+
+    result = try_lenient("Zm9v\r\n!mFy", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(6u, result.offset);
+    result = try_lenient("Zg==Zg==", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(2u, result.offset);
+    result = try_lenient("Zm9vYg=", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    result = try_lenient("Zm9vY===", out, BaseXX::eLenience::Forgiving);
+    ASSERT_NE(BaseXX::eResultCode::Success, result.code);
+
+    ASSERT_TRUE(try_lenient("Zm9v\nYmFy\n", out));
+    ASSERT_EQ("foobar", out);
+    ASSERT_THROW(base64::decode_lenient("Zm9v\n!mFy"), std::runtime_error);
+
+    // Appending rolls back on failure, unlike try_decode_lenient()
+    out = "kept";
+    base64::decode_lenient_append(out, "Zm9v\n", 5);
+    ASSERT_EQ("keptfoo", out);
+    ASSERT_THROW(base64::decode_lenient_append(out, "Zm9v\n!mFy", 9),
+        std::runtime_error);
+    ASSERT_EQ("keptfoo", out);
+
+    char buf[4] = { 0, };
+    ASSERT_EQ(3u, base64::decode_lenient_into(buf, 3, "Zm9v\n", 5));
+    ASSERT_THROW(base64::decode_lenient_into(buf, sizeof(buf),
+        "Zm9v\nYmFy", 9), std::runtime_error);
+}  // TEST(Base64, lenient)
+
+TEST(Base64, unpadded)
+{
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len++)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            std::string padded{ base64::encode_urlsafe(bytes) };
+            const std::string unpadded{
+                base64::encode_urlsafe(bytes, BaseXX::ePadding::None) };
+            ASSERT_EQ(base64::encoded_length(len, BaseXX::ePadding::None),
+                unpadded.size());
+            ASSERT_EQ(padded.substr(0, padded.find('=')), unpadded);
+
+            ASSERT_EQ(bytes, base64::decode_urlsafe(unpadded,
+                BaseXX::ePadding::Optional));
+            ASSERT_EQ(bytes, base64::decode_urlsafe(padded,
+                BaseXX::ePadding::Optional));
+            ASSERT_EQ(bytes, base64::decode_urlsafe(unpadded,
+                BaseXX::ePadding::None));
+        }
+    });
+
+    // JWT header {"alg":"HS256","typ":"JWT"}
+    const char header[] = "eyJhbGciOiJIUzI1NiIsInR5cCI6IkpXVCJ9";
+    ASSERT_EQ("{\"alg\":\"HS256\",\"typ\":\"JWT\"}",
+        base64::decode_urlsafe(header, BaseXX::ePadding::None));
+    ASSERT_EQ(header, base64::encode_urlsafe(
+        "{\"alg\":\"HS256\",\"typ\":\"JWT\"}", BaseXX::ePadding::None));
+    ASSERT_EQ("Zm9vYg", base64::encode("foob", BaseXX::ePadding::Optional));
+
+    // Padding still required by default
+    ASSERT_THROW(base64::decode("Zm9vYg"), std::runtime_error);
+
+    std::string out{};
+    BaseXX::DecodeResult result{
+        base64::try_decode("Zm9vY", out, BaseXX::ePadding::Optional) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(4u, result.offset);
+    result = base64::try_decode("Zm9vYg=", out, BaseXX::ePadding::Optional);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    result = base64::try_decode("Zm9vYg==", out, BaseXX::ePadding::None);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(6u, result.offset);
+    result = base64::try_decode("Zm9v!g", out, BaseXX::ePadding::Optional);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(4u, result.offset);
+    ASSERT_EQ("foo", out);
+
+    char buf[5] = { 0, };
+    ASSERT_EQ(5u, base64::decode_urlsafe_into(buf, sizeof(buf),
+        "Zm9vYmE", 7, BaseXX::ePadding::Optional));
+    ASSERT_EQ("fooba", std::string(buf, 5));
+    ASSERT_THROW(base64::decode_urlsafe_into(buf, 4,
+        "Zm9vYmE", 7, BaseXX::ePadding::Optional), std::runtime_error);
+}  // TEST(Base64, unpadded)
+
+TEST(Base64, inplace)
+{
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(1200) };
+        for (size_t len = 0; len <= 1200; len += (len < 300) ? 1 : 61)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            for (const auto padding :
+                { BaseXX::ePadding::Required, BaseXX::ePadding::None })
+            {
+                const std::string encoded{ base64::encode(bytes, padding) };
+                std::string buf(encoded.size(), '\0');
+                std::copy(bytes.begin(), bytes.end(),
+                    buf.end() - static_cast<std::ptrdiff_t>(len));
+                ASSERT_EQ(encoded.size(), base64::encode_inplace(
+                    &buf[0], len, base64::encoding_table, padding));
+                ASSERT_EQ(encoded, buf);
+
+                ASSERT_EQ(len, base64::decode_inplace(&buf[0], buf.size(),
+                    &base64::decode_char, padding));
+                ASSERT_EQ(bytes, buf.substr(0, len));
+            }
+
+            std::string buf(base64::encoded_length(len), '\0');
+            std::copy(bytes.begin(), bytes.end(),
+                buf.end() - static_cast<std::ptrdiff_t>(len));
+            base64::encode_urlsafe_inplace(&buf[0], len);
+            ASSERT_EQ(base64::encode_urlsafe(bytes), buf);
+            buf.resize(base64::decode_urlsafe_inplace(&buf[0], buf.size()));
+            ASSERT_EQ(bytes, buf);
+        }
+
+        // A bad character anywhere in a 400-character text: the same code,
+        // offset and decoded prefix as decoding into separate memory.
+        const std::string text{ base64::encode(data.substr(0, 300)) };
+        for (size_t bad = 0; bad < text.size(); bad++)
+        {
+            SCOPED_TRACE(bad);
+            std::string buf{ text };
+            buf[bad] = '*';
+            std::string out(text.size(), '\0');
+            const BaseXX::DecodeResult expected{ base64::try_decode_into(
+                &out[0], out.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, expected.code);
+            ASSERT_EQ(bad, expected.offset);
+
+            const BaseXX::DecodeResult result{ base64::try_decode_into(
+                &buf[0], buf.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(expected.code, result.code);
+            ASSERT_EQ(expected.offset, result.offset);
+            ASSERT_EQ(expected.written, result.written);
+            ASSERT_EQ(data.substr(0, result.written),
+                buf.substr(0, result.written));
+
+            buf = text;
+            buf[bad] = '*';
+            ASSERT_THROW(base64::decode_inplace(&buf[0], buf.size()),
+                std::runtime_error);
+        }
+    });
+
+    char text[] = "Zm9vYmFy!mF6";
+    ASSERT_THROW(base64::decode_inplace(text, 12), std::runtime_error);
+    ASSERT_EQ("foobar", std::string(text, 6));
+
+}  // TEST(Base64, inplace)
+
+TEST(Base64, validate)
+{
+    const auto same_as_decode = [](const std::string& text)
+    {
+        std::string out(text.size() + 1, '\0');
+        const BaseXX::DecodeResult decoded{ base64::try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        const BaseXX::DecodeResult checked{
+            base64::validate(text.data(), text.size()) };
+        return decoded.code == checked.code &&
+            decoded.offset == checked.offset &&
+            decoded.written == checked.written;
+    };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(600) };
+        for (size_t len = 0; len <= 600; len += (len < 200) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string encoded{ base64::encode(data.substr(0, len)) };
+            ASSERT_TRUE(base64::is_valid(encoded));
+            const BaseXX::DecodeResult size{ base64::decoded_size(encoded) };
+            ASSERT_TRUE(size);
+            ASSERT_EQ(len, size.written);
+            ASSERT_TRUE(same_as_decode(encoded));
+
+            // A bad character at the front, middle and end of the text
+            const size_t chars = encoded.find('=') == std::string::npos
+                ? encoded.size() : encoded.find('=');
+            for (const size_t at : { size_t{ 0 }, chars / 2, chars - 1 })
+            {
+                if (chars == 0)
+                {
+                    break;
+                }
+                std::string bad{ encoded };
+                bad[at] = '!';
+                ASSERT_FALSE(base64::is_valid(bad));
+                ASSERT_EQ(at, base64::decoded_size(bad).offset);
+                ASSERT_TRUE(same_as_decode(bad));
+            }
+        }
+    });
+
+    ASSERT_TRUE(base64::is_valid_urlsafe("-_-_"));
+    ASSERT_FALSE(base64::is_valid("-_-_"));
+    ASSERT_TRUE(base64::is_valid("Zm9vYg", BaseXX::ePadding::Optional));
+    ASSERT_FALSE(base64::is_valid("Zm9vYg"));
+    ASSERT_EQ(5u, base64::decoded_size_urlsafe("Zm9vYmE",
+        BaseXX::ePadding::None).written);
+
+    BaseXX::DecodeResult result{ base64::decoded_size("Zm9vY===") };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(5u, result.offset);
+    result = base64::decoded_size("Zm9vYg=");
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(4u, result.offset);
+
+    // Padding in the middle, where a decode stops short
+    result = base64::decoded_size("Zg==Zg==");
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(2u, result.offset);
+
+}  // TEST(Base64, validate)
+
+TEST(Base64, codec)
+{
+    using Codec = BaseXX::Codec<base64::StandardAlphabet, 6>;
+    using Jwt = BaseXX::Codec<
+        base64::UrlSafeAlphabet, 6, BaseXX::ePadding::None>;
+    static_assert(Codec::chars_per_group == 4, "");
+    static_assert(Codec::bytes_per_group == 3, "");
+    static_assert(Codec::max_padding == 2, "");
+    static_assert(Jwt::encoded_length(5) == 7, "");
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len += (len < 100) ? 1 : 23)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            const std::string encoded{ Codec::encode(bytes.data(), len) };
+            ASSERT_EQ(base64::encode(bytes), encoded);
+            ASSERT_EQ(bytes, Codec::decode(encoded.data(), encoded.size()));
+
+            const std::string segment{ Jwt::encode(bytes.data(), len) };
+            ASSERT_EQ(base64::encode_urlsafe(bytes, BaseXX::ePadding::None),
+                segment);
+            ASSERT_EQ(bytes, Jwt::decode(segment.data(), segment.size()));
+            ASSERT_EQ(len, Jwt::validate(segment.data(), segment.size())
+                .written);
+        }
+    });
+
+    // The Padding of the policy is only the default of every call
+    ASSERT_EQ("Zm8=", Jwt::encode("fo", 2, BaseXX::ePadding::Required));
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount,
+        Jwt::validate("Zm8=", 4).code);
+    ASSERT_EQ("fo", Jwt::decode("Zm8=", 4, BaseXX::ePadding::Optional));
+
+    // ... while the streaming functions follow it
+    {
+        const std::string data{ make_bytes(100) };
+        for (size_t len = 0; len <= data.size(); len++)
+        {
+            SCOPED_TRACE(len);
+            Jwt::Encoder encoder{};
+            std::string segment{ encoder.update(
+                BaseXX::ByteView(data.data(), len)) };
+            segment += encoder.finalize();
+            ASSERT_EQ(Jwt::encode(data.data(), len), segment);
+
+            for (size_t split = 0; split <= segment.size(); split += 5)
+            {
+                Jwt::Decoder decoder{};
+                std::string decoded{ decoder.update(
+                    BaseXX::ByteView(segment.data(), split)) };
+                decoded += decoder.update(BaseXX::ByteView(
+                    segment.data() + split, segment.size() - split));
+                decoded += decoder.finalize();
+                ASSERT_EQ(data.substr(0, len), decoded);
+            }
+        }
+
+        Jwt::Decoder jwt_decoder{};
+        ASSERT_EQ("", jwt_decoder.update("Zg"));
+        ASSERT_EQ("f", jwt_decoder.finalize());
+        ASSERT_THROW(jwt_decoder.update("Zg=="), std::runtime_error);
+        jwt_decoder.reset();
+        ASSERT_EQ("", jwt_decoder.update("Z"));
+        ASSERT_THROW(jwt_decoder.finalize(), std::runtime_error);
+
+        using Optional = BaseXX::Codec<
+            base64::StandardAlphabet, 6, BaseXX::ePadding::Optional>;
+        Optional::Decoder decoder{};
+        ASSERT_EQ("f", decoder.update("Zg=="));
+        ASSERT_EQ("", decoder.finalize());
+        ASSERT_EQ("", decoder.update("Zm8"));
+        ASSERT_EQ("fo", decoder.finalize());
+        ASSERT_EQ("fo", decoder.update("Zm8="));
+        ASSERT_THROW(decoder.update("Zg"), std::runtime_error);  // after pad
+        decoder.reset();
+        ASSERT_EQ("", decoder.update("Zg="));
+        ASSERT_THROW(decoder.finalize(), std::runtime_error);
+
+        Codec::Decoder required{};
+        ASSERT_EQ("f", required.update("Zg=="));
+        ASSERT_EQ("", required.finalize());
+        ASSERT_EQ("", required.update("Zg"));
+        ASSERT_THROW(required.finalize(), std::runtime_error);
+    }
+
+    char out[8];
+    const BaseXX::DecodeResult result{
+        Codec::try_decode_into(out, sizeof(out), "Zm9v!m8=", 8) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(4u, result.offset);
+    ASSERT_EQ(3u, result.written);
+}  // TEST(Base64, codec)
+
 TEST(Base32, encode)
 {
     ASSERT_EQ("", base32::encode(""));
@@ -407,6 +1569,622 @@ TEST(Base32, decode_hex)
     }
 }  // TEST(Base32, decode_hex)
 
+TEST(Base32, encode_decode_long)
+{
+    for_each_simd_level([]()
+    {
+        for (size_t len = 0; len < 300; len++)
+        {
+            const std::string data{
+                make_bytes(len, static_cast<uint32_t>(len + 1)) };
+            const std::string encoded{ base32::encode(data) };
+            const std::string hex_encoded{ base32::encode_hex(data) };
+            ASSERT_EQ(reference_encode(data, base32::encoding_table, 5),
+                encoded) << "len: " << len;
+            ASSERT_EQ(reference_encode(data, base32::hex_encoding_table, 5),
+                hex_encoded) << "len: " << len;
+            ASSERT_EQ(data, base32::decode(encoded)) << "len: " << len;
+            ASSERT_EQ(data, base32::decode_hex(hex_encoded))
+                << "len: " << len;
+        }
+    });
+}  // TEST(Base32, encode_decode_long)
+
+TEST(Base32, decode_invalid)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(400) };
+        const std::string encoded{ base32::encode(data) };
+        const std::string hex_encoded{ base32::encode_hex(data) };
+        for (size_t pos = 0; pos < encoded.size(); pos += 3)
+        {
+            for (const char bad : { '0', '1', '8', '@', '[', 'a', '\x80' })
+            {
+                std::string corrupted{ encoded };
+                corrupted[pos] = bad;
+                std::string out{};
+                const BaseXX::DecodeResult result{
+                    base32::try_decode(corrupted, out) };
+                ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code)
+                    << "pos: " << pos << ", char: " << bad;
+                ASSERT_EQ(pos, result.offset);
+                ASSERT_EQ(data.substr(0, pos / 8 * 5), out);
+            }
+
+            for (const char bad : { '/', ':', '@', 'W', 'a', '\xC1' })
+            {
+                std::string corrupted{ hex_encoded };
+                corrupted[pos] = bad;
+                std::string out{};
+                const BaseXX::DecodeResult result{
+                    base32::try_decode_hex(corrupted, out) };
+                ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code)
+                    << "pos: " << pos << ", char: " << bad;
+                ASSERT_EQ(pos, result.offset);
+            }
+        }
+    });
+}  // TEST(Base32, decode_invalid)
+
+TEST(Base32, into_append)
+{
+    static_assert(base32::encoded_length(0) == 0, "");
+    static_assert(base32::encoded_length(1) == 8, "");
+    static_assert(base32::encoded_length(6) == 16, "");
+    static_assert(base32::decoded_length("MFAQ====", 8) == 2, "");
+    ASSERT_EQ(1u, base32::decoded_length("LQ======", 8));
+    ASSERT_EQ(3u, base32::decoded_length("5WKZY===", 8));
+    ASSERT_EQ(4u, base32::decoded_length("LRXFYMA=", 8));
+
+    char buf[16] = { 0, };
+    ASSERT_EQ(8u, base32::encode_into(buf, 8, "\\n\\0", 4));
+    ASSERT_EQ("LRXFYMA=", std::string(buf, 8));
+    ASSERT_EQ(8u, base32::encode_hex_into(buf, 8, "\\n\\0", 4));
+    ASSERT_EQ("BHN5OC0=", std::string(buf, 8));
+    ASSERT_THROW(base32::encode_into(buf, 7, "a", 1), std::runtime_error);
+
+    ASSERT_EQ(4u, base32::decode_into(buf, 4, "LRXFYMA=", 8));
+    ASSERT_EQ("\\n\\0", std::string(buf, 4));
+    ASSERT_EQ(4u, base32::decode_hex_into(buf, 4, "BHN5OC0=", 8));
+    ASSERT_EQ("\\n\\0", std::string(buf, 4));
+    ASSERT_THROW(base32::decode_into(buf, 3, "LRXFYMA=", 8),
+        std::runtime_error);
+
+    std::string out{ ">" };
+    base32::encode_append(out, "a", 1);
+    base32::encode_hex_append(out, "a", 1);
+    ASSERT_EQ(">ME======C4======", out);
+
+    out = ">";
+    base32::decode_append(out, "ME======", 8);
+    base32::decode_hex_append(out, "C4======", 8);
+    ASSERT_EQ(">aa", out);
+}  // TEST(Base32, into_append)
+
+TEST(Base32, Encoder)
+{
+    const std::string data{ make_bytes(1000) };
+    for (size_t chunk = 1; chunk < 40; chunk++)
+    {
+        base32::Encoder encoder{};
+        base32::Encoder hex_encoder{ base32::hex_encoding_table };
+        std::string encoded{};
+        std::string hex_encoded{};
+        for (size_t pos = 0; pos < data.size(); pos += chunk)
+        {
+            const std::string piece{ data.substr(pos, chunk) };
+            encoder.update(piece.data(), piece.size(), encoded);
+            hex_encoded += hex_encoder.update(piece);
+        }
+        encoder.finalize(encoded);
+        hex_encoded += hex_encoder.finalize();
+
+        ASSERT_EQ(base32::encode(data), encoded) << "chunk: " << chunk;
+        ASSERT_EQ(base32::encode_hex(data), hex_encoded)
+            << "chunk: " << chunk;
+    }
+
+    base32::Encoder encoder{};
+    ASSERT_EQ("", encoder.update("\\n"));
+    ASSERT_EQ("LRXFYMBA", encoder.update("\\0  "));
+    ASSERT_EQ("EA======", encoder.finalize());
+}  // TEST(Base32, Encoder)
+
+TEST(Base32, Decoder)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(1001) };
+        const std::string encoded{ base32::encode(data) };
+        const std::string hex_encoded{ base32::encode_hex(data) };
+        for (size_t chunk = 1; chunk < 40; chunk++)
+        {
+            base32::Decoder decoder{};
+            base32::Decoder hex_decoder{ base32::hex_encoding_table };
+            std::string decoded{};
+            std::string hex_decoded{};
+            for (size_t pos = 0; pos < encoded.size(); pos += chunk)
+            {
+                const std::string piece{ encoded.substr(pos, chunk) };
+                decoder.update(piece.data(), piece.size(), decoded);
+                hex_decoded +=
+                    hex_decoder.update(hex_encoded.substr(pos, chunk));
+            }
+            decoder.finalize();
+            hex_decoder.finalize();
+
+            ASSERT_EQ(data, decoded) << "chunk: " << chunk;
+            ASSERT_EQ(data, hex_decoded) << "chunk: " << chunk;
+        }
+
+        std::string corrupted{ encoded };
+        corrupted[1234] = '1';
+        base32::Decoder decoder{};
+        try
+        {
+            decoder.update(corrupted);
+            FAIL() << "expected an exception";
+        }
+        catch (const std::runtime_error& e)
+        {
+            ASSERT_NE(std::string::npos,
+                std::string(e.what()).find("(offset: 1234)")) << e.what();
+        }
+    });
+
+    base32::Decoder decoder{};
+    ASSERT_EQ("", decoder.update("LRXFY"));
+    ASSERT_EQ("\\n\\0 ", decoder.update("MBAEA====="));
+    ASSERT_EQ(" ", decoder.update("="));
+    decoder.finalize();
+    ASSERT_THROW(decoder.update("MZX====="), std::runtime_error);  // 3 chars
+}  // TEST(Base32, Decoder)
+
+TEST(Base32, try_decode)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(500) };
+        std::string encoded{ base32::encode_hex(data) };
+        std::string out{};
+
+        BaseXX::DecodeResult result{ base32::try_decode_hex(encoded, out) };
+        ASSERT_TRUE(result);
+        ASSERT_EQ(data, out);
+
+        encoded[403] = 'W';
+        result = base32::try_decode_hex(encoded, out);
+        ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+        ASSERT_EQ(403u, result.offset);
+        ASSERT_EQ(data.substr(0, 400 / 8 * 5), out);
+    });
+
+    std::string out{};
+    BaseXX::DecodeResult result{ base32::try_decode("MZXW6===A", out) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(8u, result.offset);
+    result = base32::try_decode("M=======", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(1u, result.offset);
+
+    ASSERT_TRUE(base32::try_decode("MZXW6===", out));
+    ASSERT_EQ("foo", out);
+
+    char buf[5] = { 0, };
+    result = base32::try_decode_hex_into(buf, 5, "CPNMU===", 8);
+    ASSERT_TRUE(result);
+    ASSERT_EQ("foo", std::string(buf, result.written));
+}  // TEST(Base32, try_decode)
+
+TEST(Base32, alphabet)
+{
+    static_assert(base32::decode_table('A') == 0, "");
+    static_assert(base32::decode_table('7') == 31, "");
+    static_assert(base32::decode_table('0') == BaseXX::invalid_value, "");
+    static_assert(base32::hex_decode_table('V') == 31, "");
+
+    const std::string data{ make_bytes(100) };
+    const std::string encoded{
+        base32::encode_base<base32::HexAlphabet>(data.data(), data.size())
+    };
+    ASSERT_EQ(base32::encode_hex(data), encoded);
+    ASSERT_EQ(data, base32::decode_base<base32::HexAlphabet>(
+        encoded.data(), encoded.size()));
+
+    uint8_t (*lookup)(const char) = [](const char c)
+    {
+        return base32::decode_char(static_cast<char>(std::toupper(c)));
+    };
+    ASSERT_EQ("foo", base32::decode_base("mzxw6===", 8, lookup));
+}  // TEST(Base32, alphabet)
+
+TEST(Base32, parallel)
+{
+    const std::string data{ make_bytes(3 * BaseXX::parallel_min_slice + 3) };
+    const std::string encoded{ base32::encode(data) };
+    const std::string hex_encoded{ base32::encode_hex(data) };
+
+    for (size_t threads : { 1, 2, 3, 4 })
+    {
+        ASSERT_EQ(encoded,
+            base32::encode_parallel(data.data(), data.size(), threads));
+        ASSERT_EQ(hex_encoded,
+            base32::encode_parallel(data.data(), data.size(), threads,
+                base32::hex_encoding_table));
+        ASSERT_EQ(data,
+            base32::decode_parallel(encoded.data(), encoded.size(), threads));
+        ASSERT_EQ(data,
+            base32::decode_parallel(hex_encoded.data(), hex_encoded.size(),
+                threads, &base32::hex_decode_char));
+    }
+
+    std::string corrupted{ encoded };
+    corrupted[encoded.size() / 3] = '1';
+    std::string serial(encoded.size(), '\0');
+    std::string parallel(encoded.size(), '\0');
+    BaseXX::DecodeResult expected = base32::try_decode_into(&serial[0],
+        serial.size(), corrupted.data(), corrupted.size());
+    BaseXX::DecodeResult result = base32::try_decode_parallel_into(
+        &parallel[0], parallel.size(), corrupted.data(), corrupted.size(), 4);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(expected.offset, result.offset);
+    ASSERT_EQ(expected.written, result.written);
+
+    corrupted = encoded;
+    corrupted.replace(encoded.size() / 8 * 4, 8, "MY======");
+    expected = base32::try_decode_into(&serial[0],
+        serial.size(), corrupted.data(), corrupted.size());
+    result = base32::try_decode_parallel_into(
+        &parallel[0], parallel.size(), corrupted.data(), corrupted.size(), 4);
+    ASSERT_EQ(expected.code, result.code);
+    ASSERT_EQ(expected.written, result.written);
+}  // TEST(Base32, parallel)
+
+TEST(Base32, batch)
+{
+    BaseXX::Column column{};
+    for (size_t len = 0; len < 70; len++)
+    {
+        const std::string value{ make_bytes(len, static_cast<uint32_t>(len)) };
+        column.push_back(value.data(), value.size());
+    }
+
+    const BaseXX::Column encoded{ base32::encode_batch(column) };
+    const BaseXX::Column hex_encoded{
+        base32::encode_batch(column, base32::hex_encoding_table) };
+    for (size_t row = 0; row < column.rows(); row++)
+    {
+        ASSERT_EQ(base32::encode(column.row(row)), encoded.row(row));
+        ASSERT_EQ(base32::encode_hex(column.row(row)), hex_encoded.row(row));
+    }
+    ASSERT_EQ(column.data, base32::decode_batch(encoded).data);
+    ASSERT_EQ(column.data,
+        base32::decode_batch(hex_encoded, &base32::hex_decode_char).data);
+
+    BaseXX::Column corrupted{ encoded };
+    corrupted.data[corrupted.offsets[10] + 3] = '0';
+    BaseXX::Column decoded{};
+    std::vector<BaseXX::RowError> errors{};
+    ASSERT_EQ(1u, base32::try_decode_batch(corrupted, decoded, errors));
+    ASSERT_EQ(10u, errors[0].row);
+    ASSERT_EQ(3u, errors[0].result.offset);
+    ASSERT_EQ(0u, decoded.row_size(10));
+    ASSERT_EQ(column.row(11), decoded.row(11));
+}  // TEST(Base32, batch)
+
+TEST(Base32, allocator)
+{
+    size_t allocated = 0;
+    const CountingAllocator<char> alloc{ &allocated };
+
+    const counted_string encoded{
+        base32::encode<counted_string>("foob", alloc) };
+    ASSERT_EQ("MZXW6YQ=", std::string(encoded.begin(), encoded.end()));
+
+    const size_t before_decode = allocated;
+    const counted_bytes decoded{
+        base32::decode<counted_bytes>("MZXW6YQ=", alloc) };
+    ASSERT_LT(before_decode, allocated);
+    ASSERT_EQ("foob", std::string(decoded.begin(), decoded.end()));
+    ASSERT_EQ("CPNMUOG=", base32::encode_hex<std::string>("foob"));
+    ASSERT_EQ("foob", base32::decode_hex<std::string>("CPNMUOG="));
+
+    counted_bytes out{ alloc };
+    base32::encode_append(out, "foob", 4);
+    ASSERT_EQ("MZXW6YQ=", std::string(out.begin(), out.end()));
+    out.clear();
+    ASSERT_EQ(BaseXX::eResultCode::Success,
+        base32::try_decode("MZXW6YQ=", out).code);
+    ASSERT_EQ("foob", std::string(out.begin(), out.end()));
+    ASSERT_THROW(base32::decode<counted_string>("!!!!!!!!", alloc),
+        std::runtime_error);
+
+#ifdef BASEXX_TEST_PMR
+    char arena_buf[4096];
+    std::pmr::monotonic_buffer_resource arena{ arena_buf, sizeof(arena_buf),
+        std::pmr::null_memory_resource() };
+    const std::pmr::string pmr_encoded{
+        base32::encode<std::pmr::string>(make_bytes(100), &arena) };
+    ASSERT_EQ(base32::encode(make_bytes(100)),
+        std::string(pmr_encoded.begin(), pmr_encoded.end()));
+    const std::pmr::vector<uint8_t> pmr_decoded{
+        base32::decode<std::pmr::vector<uint8_t>>(pmr_encoded, &arena) };
+    ASSERT_EQ(make_bytes(100),
+        std::string(pmr_decoded.begin(), pmr_decoded.end()));
+#endif
+}  // TEST(Base32, allocator)
+
+TEST(Base32, byte_range)
+{
+    const char* const cstr{ "foob" };
+    const std::array<uint8_t, 4> array{ { 'f', 'o', 'o', 'b' } };
+    const std::vector<uint8_t> vec(array.begin(), array.end());
+    ASSERT_EQ("MZXW6YQ=", base32::encode(cstr));
+    ASSERT_EQ("MZXW6YQ=", base32::encode({ cstr, 4 }));
+    ASSERT_EQ("MZXW6YQ=", base32::encode(array));
+    ASSERT_EQ("MZXW6YQ=", base32::encode(vec));
+    ASSERT_EQ("CPNMUOG=", base32::encode_hex(array));
+    ASSERT_EQ("foob", base32::decode_hex(std::string("CPNMUOG=")));
+
+    std::array<char, 8> encoded{};
+    ASSERT_EQ(8u, base32::encode_into(encoded, vec));
+    ASSERT_EQ("MZXW6YQ=", std::string(encoded.begin(), encoded.end()));
+
+    std::array<uint8_t, 8> decoded{};
+    ASSERT_EQ(4u, base32::decode_into(decoded, encoded));
+    ASSERT_TRUE(std::equal(array.begin(), array.end(), decoded.begin()));
+    ASSERT_EQ(vec, base32::decode<std::vector<uint8_t>>(encoded));
+
+    std::array<uint8_t, 3> small{};
+    ASSERT_THROW(base32::decode_into(small, encoded), std::runtime_error);
+
+#if __cplusplus >= 201703L
+    const std::vector<std::byte> bytes{
+        reinterpret_cast<const std::byte*>(cstr),
+        reinterpret_cast<const std::byte*>(cstr) + 4 };
+    ASSERT_EQ("MZXW6YQ=", base32::encode(bytes));
+    ASSERT_EQ("MZXW6YQ=", base32::encode(std::string_view{ cstr, 4 }));
+    ASSERT_EQ(bytes, base32::decode<std::vector<std::byte>>("MZXW6YQ="));
+#endif
+#ifdef BASEXX_TEST_SPAN
+    ASSERT_EQ("MZXW6YQ=", base32::encode(std::span<const uint8_t>{ vec }));
+    ASSERT_EQ(vec,
+        base32::decode<std::vector<uint8_t>>(std::span<const char>{ encoded }));
+#endif
+}  // TEST(Base32, byte_range)
+
+TEST(Base32, literal)
+{
+    constexpr auto encoded = base32::encode_literal("foobar");
+    static_assert(encoded.size() == 16, "");
+    constexpr auto decoded = base32::decode_literal("MZXW6YTBOI======");
+    static_assert(decoded.size() == 6 && decoded[5] == 'r', "");
+    constexpr auto hex =
+        base32::decode_literal<base32::HexAlphabet>("CPNMUOG=");
+    static_assert(hex.size() == 4 && hex[3] == 'b', "");
+
+    ASSERT_EQ("MZXW6YTBOI======",
+        std::string(encoded.begin(), encoded.end()));
+    ASSERT_EQ("foobar", std::string(decoded.begin(), decoded.end()));
+    ASSERT_TRUE(base32::decode_literal("").empty());
+    ASSERT_EQ("MY======", base32::encode(base32::decode_literal("MY======")));
+    ASSERT_EQ("MZXQ====", base32::encode(base32::decode_literal("MZXQ====")));
+    ASSERT_EQ("MZXW6===", base32::encode(base32::decode_literal("MZXW6===")));
+    ASSERT_EQ("MZXW6YQ=", base32::encode(base32::decode_literal("MZXW6YQ=")));
+
+    const char bad_padding[] = "MZX=====";
+    const char bad_char[] = "MZXW6YQ1";
+    ASSERT_THROW(base32::decode_literal(bad_padding), std::runtime_error);
+    ASSERT_THROW(base32::decode_literal(bad_char), std::runtime_error);
+}  // TEST(Base32, literal)
+
+TEST(Base32, unpadded)
+{
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len++)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            std::string padded{ base32::encode_hex(bytes) };
+            const std::string unpadded{
+                base32::encode_hex(bytes, BaseXX::ePadding::None) };
+            ASSERT_EQ(base32::encoded_length(len, BaseXX::ePadding::None),
+                unpadded.size());
+            ASSERT_EQ(padded.substr(0, padded.find('=')), unpadded);
+
+            ASSERT_EQ(bytes, base32::decode_hex(unpadded,
+                BaseXX::ePadding::Optional));
+            ASSERT_EQ(bytes, base32::decode_hex(padded,
+                BaseXX::ePadding::Optional));
+            ASSERT_EQ(bytes, base32::decode(base32::encode(bytes,
+                BaseXX::ePadding::None), BaseXX::ePadding::None));
+        }
+    });
+
+    ASSERT_EQ("MZXW6YQ", base32::encode("foob", BaseXX::ePadding::None));
+    ASSERT_EQ("foob", base32::decode("MZXW6YQ", BaseXX::ePadding::Optional));
+    ASSERT_THROW(base32::decode("MZXW6YQ"), std::runtime_error);
+
+    // Only 2, 4, 5 or 7 characters can end an unpadded text
+    std::string out{};
+    for (const char* text : { "MZXW6Y", "MZXW6YQB3", "MZX" })
+    {
+        SCOPED_TRACE(text);
+        const BaseXX::DecodeResult result{
+            base32::try_decode(text, out, BaseXX::ePadding::Optional) };
+        ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    }
+    const BaseXX::DecodeResult result{
+        base32::try_decode("MZXW6YQ=", out, BaseXX::ePadding::None) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(7u, result.offset);
+}  // TEST(Base32, unpadded)
+
+TEST(Base32, inplace)
+{
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(1200) };
+        for (size_t len = 0; len <= 1200; len += (len < 300) ? 1 : 61)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            for (const auto padding :
+                { BaseXX::ePadding::Required, BaseXX::ePadding::None })
+            {
+                const std::string encoded{ base32::encode(bytes, padding) };
+                std::string buf(encoded.size(), '\0');
+                std::copy(bytes.begin(), bytes.end(),
+                    buf.end() - static_cast<std::ptrdiff_t>(len));
+                ASSERT_EQ(encoded.size(), base32::encode_inplace(
+                    &buf[0], len, base32::encoding_table, padding));
+                ASSERT_EQ(encoded, buf);
+
+                ASSERT_EQ(len, base32::decode_inplace(&buf[0], buf.size(),
+                    &base32::decode_char, padding));
+                ASSERT_EQ(bytes, buf.substr(0, len));
+            }
+
+            std::string buf(base32::encoded_length(len), '\0');
+            std::copy(bytes.begin(), bytes.end(),
+                buf.end() - static_cast<std::ptrdiff_t>(len));
+            base32::encode_hex_inplace(&buf[0], len);
+            ASSERT_EQ(base32::encode_hex(bytes), buf);
+            buf.resize(base32::decode_hex_inplace(&buf[0], buf.size()));
+            ASSERT_EQ(bytes, buf);
+        }
+
+        // A bad character anywhere in a 400-character text: the same code,
+        // offset and decoded prefix as decoding into separate memory.
+        const std::string text{ base32::encode(data.substr(0, 250)) };
+        for (size_t bad = 0; bad < text.size(); bad++)
+        {
+            SCOPED_TRACE(bad);
+            std::string buf{ text };
+            buf[bad] = '*';
+            std::string out(text.size(), '\0');
+            const BaseXX::DecodeResult expected{ base32::try_decode_into(
+                &out[0], out.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, expected.code);
+            ASSERT_EQ(bad, expected.offset);
+
+            const BaseXX::DecodeResult result{ base32::try_decode_into(
+                &buf[0], buf.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(expected.code, result.code);
+            ASSERT_EQ(expected.offset, result.offset);
+            ASSERT_EQ(expected.written, result.written);
+            ASSERT_EQ(data.substr(0, result.written),
+                buf.substr(0, result.written));
+
+            buf = text;
+            buf[bad] = '*';
+            ASSERT_THROW(base32::decode_inplace(&buf[0], buf.size()),
+                std::runtime_error);
+        }
+    });
+
+    char text[] = "MZXW6YTBOI======";
+    ASSERT_EQ(6u, base32::decode_inplace(text, 16));
+    ASSERT_EQ("foobar", std::string(text, 6));
+
+}  // TEST(Base32, inplace)
+
+TEST(Base32, validate)
+{
+    const auto same_as_decode = [](const std::string& text)
+    {
+        std::string out(text.size() + 1, '\0');
+        const BaseXX::DecodeResult decoded{ base32::try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        const BaseXX::DecodeResult checked{
+            base32::validate(text.data(), text.size()) };
+        return decoded.code == checked.code &&
+            decoded.offset == checked.offset &&
+            decoded.written == checked.written;
+    };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(600) };
+        for (size_t len = 0; len <= 600; len += (len < 200) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string encoded{ base32::encode(data.substr(0, len)) };
+            ASSERT_TRUE(base32::is_valid(encoded));
+            const BaseXX::DecodeResult size{ base32::decoded_size(encoded) };
+            ASSERT_TRUE(size);
+            ASSERT_EQ(len, size.written);
+            ASSERT_TRUE(same_as_decode(encoded));
+
+            // A bad character at the front, middle and end of the text
+            const size_t chars = encoded.find('=') == std::string::npos
+                ? encoded.size() : encoded.find('=');
+            for (const size_t at : { size_t{ 0 }, chars / 2, chars - 1 })
+            {
+                if (chars == 0)
+                {
+                    break;
+                }
+                std::string bad{ encoded };
+                bad[at] = '!';
+                ASSERT_FALSE(base32::is_valid(bad));
+                ASSERT_EQ(at, base32::decoded_size(bad).offset);
+                ASSERT_TRUE(same_as_decode(bad));
+            }
+        }
+    });
+
+    ASSERT_TRUE(base32::is_valid_hex("CPNMU==="));
+    ASSERT_FALSE(base32::is_valid("CPNMU0=="));
+    ASSERT_TRUE(base32::is_valid("MZXW6YQ", BaseXX::ePadding::Optional));
+    ASSERT_EQ(4u, base32::decoded_size_hex("CPNMUOG",
+        BaseXX::ePadding::None).written);
+
+    // Only 2, 4, 5 or 7 characters can precede the padding
+    BaseXX::DecodeResult result{ base32::decoded_size("MZXW6Y==") };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount, result.code);
+    ASSERT_EQ(6u, result.offset);
+    result = base32::decoded_size("MZXW6Y=");
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+
+}  // TEST(Base32, validate)
+
+TEST(Base32, codec)
+{
+    using Codec = BaseXX::Codec<base32::HexAlphabet, 5>;
+    static_assert(Codec::chars_per_group == 8, "");
+    static_assert(Codec::bytes_per_group == 5, "");
+    static_assert(Codec::max_padding == 6, "");
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len += (len < 100) ? 1 : 23)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            const std::string encoded{ Codec::encode(bytes.data(), len) };
+            ASSERT_EQ(base32::encode_hex(bytes), encoded);
+            ASSERT_EQ(bytes, Codec::decode(encoded.data(), encoded.size()));
+
+            const std::string unpadded{ Codec::encode(
+                bytes.data(), len, BaseXX::ePadding::None) };
+            ASSERT_EQ(bytes, Codec::decode(unpadded.data(), unpadded.size(),
+                BaseXX::ePadding::Optional));
+        }
+    });
+
+    // Padding must complete a group of 2, 4, 5 or 7 characters
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount,
+        Codec::check_format("CPNMUO==", 8));
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount,
+        base32::check_format("MZXW6Y==", 8));
+    ASSERT_THROW(base32::decode("MZXW6Y=="), std::runtime_error);
+}  // TEST(Base32, codec)
+
 TEST(Base16, encode)
 {
     ASSERT_EQ("", base16::encode(""));
@@ -503,3 +2281,904 @@ TEST(Base16, decode)
     }
 }  // TEST(Base16, decode)
 
+TEST(Base16, encode_decode_long)
+{
+    for_each_simd_level([]()
+    {
+        for (size_t len = 0; len < 300; len++)
+        {
+            const std::string data{
+                make_bytes(len, static_cast<uint32_t>(len + 1)) };
+            const std::string encoded{ base16::encode(data) };
+            ASSERT_EQ(reference_encode(data, base16::encoding_table, 4),
+                encoded) << "len: " << len;
+            ASSERT_EQ(data, base16::decode(encoded)) << "len: " << len;
+        }
+    });
+}  // TEST(Base16, encode_decode_long)
+
+TEST(Base16, letter_case)
+{
+    for_each_simd_level([]()
+    {
+        for (size_t len = 0; len < 200; len++)
+        {
+            const std::string data{
+                make_bytes(len, static_cast<uint32_t>(len + 7)) };
+            const std::string lower{ base16::encode_lower(data) };
+            ASSERT_EQ(
+                reference_encode(data, base16::lowercase_encoding_table, 4),
+                lower) << "len: " << len;
+
+            std::string mixed{ base16::encode(data) };
+            for (size_t i = 0; i < mixed.size(); i += 3)
+            {
+                mixed[i] = static_cast<char>(std::tolower(mixed[i]));
+            }
+            ASSERT_EQ(data, base16::decode_any_case(mixed)) << "len: " << len;
+            ASSERT_EQ(data, base16::decode_any_case(lower)) << "len: " << len;
+            ASSERT_EQ(data, base16::decode_base<base16::LowercaseAlphabet>(
+                lower.data(), lower.size())) << "len: " << len;
+        }
+
+        // Neighbours of the accepted ranges are rejected at their offset
+        const std::string encoded{ base16::encode_lower(make_bytes(64)) };
+        for (const char bad : { '/', ':', '@', 'G', '`', 'g', '\x80', ' ' })
+        {
+            for (size_t pos = 0; pos < encoded.size(); pos += 5)
+            {
+                std::string corrupted{ encoded };
+                corrupted[pos] = bad;
+                std::string out{};
+                const BaseXX::DecodeResult result{
+                    base16::try_decode_any_case(corrupted, out) };
+                ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+                ASSERT_EQ(pos, result.offset);
+                ASSERT_EQ(pos / 2, out.size());
+            }
+        }
+
+        ASSERT_THROW(base16::decode(encoded), std::runtime_error);
+
+        // Every byte value over a whole block of each kernel
+        for (int c = 0; c < 256; c++)
+        {
+            SCOPED_TRACE(c);
+            const std::string text(64, static_cast<char>(c));
+            const bool digit = (c >= '0' && c <= '9');
+            const bool upper = digit || (c >= 'A' && c <= 'F');
+            const bool lower = digit || (c >= 'a' && c <= 'f');
+
+            std::string out{};
+            ASSERT_EQ(upper, static_cast<bool>(base16::try_decode(text, out)));
+            ASSERT_EQ(upper, base16::is_valid(text));
+            ASSERT_EQ(lower, static_cast<bool>(
+                base16::validate<base16::LowercaseAlphabet>(
+                    text.data(), text.size())));
+            ASSERT_EQ(upper || lower, base16::is_valid_any_case(text));
+            const BaseXX::DecodeResult result{
+                base16::try_decode_any_case(text, out) };
+            ASSERT_EQ(upper || lower, static_cast<bool>(result));
+            if (result)
+            {
+                const uint8_t value = base16::any_case_decode_table(
+                    static_cast<char>(c));
+                ASSERT_EQ(std::string(32, static_cast<char>(value * 17)), out);
+            }
+            else
+            {
+                ASSERT_EQ(0u, result.offset);
+            }
+        }
+    });
+
+    base16::Decoder decoder{ base16::eLetterCase::Any };
+    ASSERT_EQ("\xED", decoder.update("eD9"));
+    ASSERT_EQ("\x95\x9C", decoder.update("59c"));
+    decoder.finalize();
+
+    std::string out{ ">" };
+    base16::encode_lower_append(out, "\xAB", 1);
+    ASSERT_EQ(">ab", out);
+    base16::decode_any_case_append(out, "aB", 2);
+    ASSERT_EQ(">ab\xAB", out);
+}  // TEST(Base16, letter_case)
+
+TEST(Base16, into_append)
+{
+    static_assert(base16::encoded_length(3) == 6, "");
+    static_assert(base16::decoded_length("ED959C", 6) == 3, "");
+
+    char buf[8] = { 0, };
+    ASSERT_EQ(6u, base16::encode_into(buf, 6, "\xED\x95\x9C", 3));
+    ASSERT_EQ("ED959C", std::string(buf, 6));
+    ASSERT_THROW(base16::encode_into(buf, 5, "\xED\x95\x9C", 3),
+        std::runtime_error);
+    ASSERT_EQ(3u, base16::decode_into(buf, 3, "ED959C", 6));
+    ASSERT_EQ("한", std::string(buf, 3));
+    ASSERT_THROW(base16::decode_into(buf, 2, "ED959C", 6),
+        std::runtime_error);
+
+    std::string out{ "0x" };
+    base16::encode_append(out, "\xED\x95\x9C", 3);
+    ASSERT_EQ("0xED959C", out);
+
+    out = ">";
+    base16::decode_append(out, "ED959C", 6);
+    ASSERT_EQ(">한", out);
+    ASSERT_THROW(base16::decode_append(out, "GG", 2), std::runtime_error);
+    ASSERT_EQ(">한", out);
+}  // TEST(Base16, into_append)
+
+TEST(Base16, Decoder)
+{
+    for_each_simd_level([]()
+    {
+        const std::string data{ make_bytes(1001) };
+        const std::string encoded{ base16::encode(data) };
+        for (size_t chunk = 1; chunk < 40; chunk++)
+        {
+            base16::Decoder decoder{};
+            std::string decoded{};
+            for (size_t pos = 0; pos < encoded.size(); pos += chunk)
+            {
+                decoded += decoder.update(encoded.substr(pos, chunk));
+            }
+            decoder.finalize();
+
+            ASSERT_EQ(data, decoded) << "chunk: " << chunk;
+        }
+    });
+
+    base16::Decoder decoder{};
+    ASSERT_EQ("", decoder.update("E"));
+    ASSERT_EQ("\xED\x95", decoder.update("D959"));
+    ASSERT_EQ("\x9C", decoder.update("C"));
+    ASSERT_EQ(6u, decoder.offset());
+    try
+    {
+        decoder.update("0G");
+        FAIL() << "expected an exception";
+    }
+    catch (const std::runtime_error& e)
+    {
+        ASSERT_NE(std::string::npos,
+            std::string(e.what()).find("(offset: 7)")) << e.what();
+    }
+    decoder.reset();
+    decoder.update("A");
+    ASSERT_THROW(decoder.finalize(), std::runtime_error);
+}  // TEST(Base16, Decoder)
+
+TEST(Base16, try_decode)
+{
+    std::string out{};
+    ASSERT_TRUE(base16::try_decode("ED959C", out));
+    ASSERT_EQ("한", out);
+
+    BaseXX::DecodeResult result{ base16::try_decode("ED959", out) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(4u, result.offset);
+
+    result = base16::try_decode("ED95G9", out);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(4u, result.offset);
+    ASSERT_EQ(2u, result.written);
+    ASSERT_EQ("\xED\x95", out);
+
+    char buf[2] = { 0, };
+    result = base16::try_decode_into(buf, 2, "ED959C", 6);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidBufferSize, result.code);
+}  // TEST(Base16, try_decode)
+
+TEST(Base16, alphabet)
+{
+    static_assert(base16::decode_table('F') == 15, "");
+    static_assert(base16::decode_table('G') == BaseXX::invalid_value, "");
+
+    ASSERT_EQ("ED959C",
+        base16::encode_base<base16::StandardAlphabet>("\xED\x95\x9C", 3));
+    ASSERT_EQ("한",
+        base16::decode_base<base16::StandardAlphabet>("ED959C", 6));
+}  // TEST(Base16, alphabet)
+
+TEST(Base16, parallel)
+{
+    const std::string data{ make_bytes(2 * BaseXX::parallel_min_slice + 1) };
+    const std::string encoded{ base16::encode(data) };
+
+    for (size_t threads : { 1, 2, 3, 4 })
+    {
+        ASSERT_EQ(encoded,
+            base16::encode_parallel(data.data(), data.size(), threads));
+        ASSERT_EQ(data,
+            base16::decode_parallel(encoded.data(), encoded.size(), threads));
+        ASSERT_EQ(data,
+            base16::decode_parallel<base16::AnyCaseAlphabet>(
+                encoded.data(), encoded.size(), threads));
+    }
+
+    std::string corrupted{ encoded };
+    corrupted[encoded.size() - 3] = 'g';
+    std::string parallel(encoded.size(), '\0');
+    const BaseXX::DecodeResult result = base16::try_decode_parallel_into(
+        &parallel[0], parallel.size(), corrupted.data(), corrupted.size(), 4);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(encoded.size() - 3, result.offset);
+    ASSERT_EQ(encoded.size() / 2 - 2, result.written);
+}  // TEST(Base16, parallel)
+
+TEST(Base16, batch)
+{
+    BaseXX::Column column{};
+    for (size_t len = 0; len < 70; len++)
+    {
+        const std::string value{ make_bytes(len, static_cast<uint32_t>(len)) };
+        column.push_back(value.data(), value.size());
+    }
+
+    const BaseXX::Column encoded{ base16::encode_batch(column) };
+    const BaseXX::Column lower_encoded{
+        base16::encode_batch(column, base16::lowercase_encoding_table) };
+    for (size_t row = 0; row < column.rows(); row++)
+    {
+        ASSERT_EQ(base16::encode(column.row(row)), encoded.row(row));
+    }
+    ASSERT_EQ(column.data, base16::decode_batch(encoded).data);
+    ASSERT_EQ(column.data,
+        base16::decode_batch<base16::AnyCaseAlphabet>(lower_encoded).data);
+    ASSERT_THROW(base16::decode_batch(lower_encoded), std::runtime_error);
+
+    BaseXX::Column decoded{};
+    std::vector<BaseXX::RowError> errors{};
+    const size_t failed =
+        base16::try_decode_batch(lower_encoded, decoded, errors);
+    ASSERT_NE(0u, failed);
+    ASSERT_EQ(failed, errors.size());
+    for (const BaseXX::RowError& error : errors)
+    {
+        ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, error.result.code);
+        ASSERT_EQ(0u, decoded.row_size(error.row));
+    }
+}  // TEST(Base16, batch)
+
+TEST(Base16, allocator)
+{
+    size_t allocated = 0;
+    const CountingAllocator<char> alloc{ &allocated };
+
+    const counted_string encoded{
+        base16::encode<counted_string>("foob", alloc) };
+    ASSERT_EQ("666F6F62", std::string(encoded.begin(), encoded.end()));
+
+    const size_t before_decode = allocated;
+    const counted_bytes decoded{
+        base16::decode<counted_bytes>("666F6F62", alloc) };
+    ASSERT_LT(before_decode, allocated);
+    ASSERT_EQ("foob", std::string(decoded.begin(), decoded.end()));
+    ASSERT_EQ("ab", base16::encode_lower<std::string>("\xab"));
+    ASSERT_EQ("\xab", base16::decode_any_case<std::string>("ab"));
+
+    counted_bytes out{ alloc };
+    base16::encode_append(out, "foob", 4);
+    ASSERT_EQ("666F6F62", std::string(out.begin(), out.end()));
+    out.clear();
+    ASSERT_EQ(BaseXX::eResultCode::Success,
+        base16::try_decode("666F6F62", out).code);
+    ASSERT_EQ("foob", std::string(out.begin(), out.end()));
+    ASSERT_THROW(base16::decode<counted_string>("!!!!!!!!", alloc),
+        std::runtime_error);
+
+#ifdef BASEXX_TEST_PMR
+    char arena_buf[4096];
+    std::pmr::monotonic_buffer_resource arena{ arena_buf, sizeof(arena_buf),
+        std::pmr::null_memory_resource() };
+    const std::pmr::string pmr_encoded{
+        base16::encode<std::pmr::string>(make_bytes(100), &arena) };
+    ASSERT_EQ(base16::encode(make_bytes(100)),
+        std::string(pmr_encoded.begin(), pmr_encoded.end()));
+    const std::pmr::vector<uint8_t> pmr_decoded{
+        base16::decode<std::pmr::vector<uint8_t>>(pmr_encoded, &arena) };
+    ASSERT_EQ(make_bytes(100),
+        std::string(pmr_decoded.begin(), pmr_decoded.end()));
+#endif
+}  // TEST(Base16, allocator)
+
+TEST(Base16, byte_range)
+{
+    const char* const cstr{ "foob" };
+    const std::array<uint8_t, 4> array{ { 'f', 'o', 'o', 'b' } };
+    const std::vector<uint8_t> vec(array.begin(), array.end());
+    ASSERT_EQ("666F6F62", base16::encode(cstr));
+    ASSERT_EQ("666F6F62", base16::encode({ cstr, 4 }));
+    ASSERT_EQ("666F6F62", base16::encode(array));
+    ASSERT_EQ("666F6F62", base16::encode(vec));
+    ASSERT_EQ("666f6f62", base16::encode_lower(array));
+    ASSERT_EQ("foob", base16::decode_any_case(std::string("666f6f62")));
+
+    std::array<char, 8> encoded{};
+    ASSERT_EQ(8u, base16::encode_into(encoded, vec));
+    ASSERT_EQ("666F6F62", std::string(encoded.begin(), encoded.end()));
+
+    std::array<uint8_t, 8> decoded{};
+    ASSERT_EQ(4u, base16::decode_into(decoded, encoded));
+    ASSERT_TRUE(std::equal(array.begin(), array.end(), decoded.begin()));
+    ASSERT_EQ(vec, base16::decode<std::vector<uint8_t>>(encoded));
+
+    std::array<uint8_t, 3> small{};
+    ASSERT_THROW(base16::decode_into(small, encoded), std::runtime_error);
+
+#if __cplusplus >= 201703L
+    const std::vector<std::byte> bytes{
+        reinterpret_cast<const std::byte*>(cstr),
+        reinterpret_cast<const std::byte*>(cstr) + 4 };
+    ASSERT_EQ("666F6F62", base16::encode(bytes));
+    ASSERT_EQ("666F6F62", base16::encode(std::string_view{ cstr, 4 }));
+    ASSERT_EQ(bytes, base16::decode<std::vector<std::byte>>("666F6F62"));
+#endif
+#ifdef BASEXX_TEST_SPAN
+    ASSERT_EQ("666F6F62", base16::encode(std::span<const uint8_t>{ vec }));
+    ASSERT_EQ(vec,
+        base16::decode<std::vector<uint8_t>>(std::span<const char>{ encoded }));
+#endif
+}  // TEST(Base16, byte_range)
+
+TEST(Base16, literal)
+{
+    constexpr auto encoded = base16::encode_literal("\x7F" "ELF");
+    static_assert(encoded.size() == 8, "");
+    static_assert(encoded[0] == '7' && encoded[1] == 'F', "");
+    constexpr auto decoded = base16::decode_literal("DEADBEEF");
+    static_assert(decoded.size() == 4 && decoded[0] == 0xDE, "");
+    constexpr auto lower =
+        base16::decode_literal<base16::AnyCaseAlphabet>("deadBEEF");
+    static_assert(lower[3] == 0xEF, "");
+
+    ASSERT_EQ("7F454C46", std::string(encoded.begin(), encoded.end()));
+    ASSERT_EQ("DEADBEEF", base16::encode(decoded));
+    ASSERT_TRUE(base16::decode_literal("").empty());
+
+    const char odd[] = "DEA";
+    const char lowercase[] = "dead";
+    ASSERT_THROW(base16::decode_literal(odd), std::runtime_error);
+    ASSERT_THROW(base16::decode_literal(lowercase), std::runtime_error);
+}  // TEST(Base16, literal)
+
+TEST(Base16, inplace)
+{
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(1200) };
+        for (size_t len = 0; len <= 1200; len += (len < 300) ? 1 : 61)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            std::string buf(base16::encoded_length(len), '\0');
+            std::copy(bytes.begin(), bytes.end(),
+                buf.end() - static_cast<std::ptrdiff_t>(len));
+            ASSERT_EQ(buf.size(), base16::encode_inplace(&buf[0], len));
+            ASSERT_EQ(base16::encode(bytes), buf);
+            ASSERT_EQ(len, base16::decode_inplace(&buf[0], buf.size()));
+            ASSERT_EQ(bytes, buf.substr(0, len));
+
+            buf.assign(base16::encoded_length(len), '\0');
+            std::copy(bytes.begin(), bytes.end(),
+                buf.end() - static_cast<std::ptrdiff_t>(len));
+            base16::encode_lower_inplace(&buf[0], len);
+            ASSERT_EQ(base16::encode_lower(bytes), buf);
+            buf.resize(base16::decode_any_case_inplace(&buf[0], buf.size()));
+            ASSERT_EQ(bytes, buf);
+        }
+
+        // A bad character anywhere in a 400-character text: the same code,
+        // offset and decoded prefix as decoding into separate memory.
+        const std::string text{ base16::encode(data.substr(0, 200)) };
+        for (size_t bad = 0; bad < text.size(); bad++)
+        {
+            SCOPED_TRACE(bad);
+            std::string buf{ text };
+            buf[bad] = '*';
+            std::string out(text.size(), '\0');
+            const BaseXX::DecodeResult expected{ base16::try_decode_into(
+                &out[0], out.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, expected.code);
+            ASSERT_EQ(bad, expected.offset);
+
+            const BaseXX::DecodeResult result{ base16::try_decode_into(
+                &buf[0], buf.size(), buf.data(), buf.size()) };
+            ASSERT_EQ(expected.code, result.code);
+            ASSERT_EQ(expected.offset, result.offset);
+            ASSERT_EQ(expected.written, result.written);
+            ASSERT_EQ(data.substr(0, result.written),
+                buf.substr(0, result.written));
+
+            buf = text;
+            buf[bad] = '*';
+            ASSERT_THROW(base16::decode_inplace(&buf[0], buf.size()),
+                std::runtime_error);
+        }
+    });
+
+    char text[] = "666F6F6g";
+    ASSERT_THROW(base16::decode_inplace(text, 8), std::runtime_error);
+    ASSERT_EQ("foo", std::string(text, 3));
+
+}  // TEST(Base16, inplace)
+
+TEST(Base16, validate)
+{
+    const auto same_as_decode = [](const std::string& text)
+    {
+        std::string out(text.size() + 1, '\0');
+        const BaseXX::DecodeResult decoded{ base16::try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        const BaseXX::DecodeResult checked{
+            base16::validate(text.data(), text.size()) };
+        return decoded.code == checked.code &&
+            decoded.offset == checked.offset &&
+            decoded.written == checked.written;
+    };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(600) };
+        for (size_t len = 0; len <= 600; len += (len < 200) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string encoded{ base16::encode(data.substr(0, len)) };
+            ASSERT_TRUE(base16::is_valid(encoded));
+            const BaseXX::DecodeResult size{ base16::decoded_size(encoded) };
+            ASSERT_TRUE(size);
+            ASSERT_EQ(len, size.written);
+            ASSERT_TRUE(same_as_decode(encoded));
+
+            // A bad character at the front, middle and end of the text
+            const size_t chars = encoded.find('=') == std::string::npos
+                ? encoded.size() : encoded.find('=');
+            for (const size_t at : { size_t{ 0 }, chars / 2, chars - 1 })
+            {
+                if (chars == 0)
+                {
+                    break;
+                }
+                std::string bad{ encoded };
+                bad[at] = '!';
+                ASSERT_FALSE(base16::is_valid(bad));
+                ASSERT_EQ(at, base16::decoded_size(bad).offset);
+                ASSERT_TRUE(same_as_decode(bad));
+            }
+        }
+    });
+
+    ASSERT_TRUE(base16::is_valid_any_case("c0fFee"));
+    ASSERT_FALSE(base16::is_valid("c0fFee"));
+    ASSERT_EQ(3u, base16::decoded_size_any_case("c0fFee").written);
+
+    const BaseXX::DecodeResult result{ base16::decoded_size("C0FFE") };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(4u, result.offset);
+
+}  // TEST(Base16, validate)
+
+TEST(Base16, codec)
+{
+    using Codec = BaseXX::Codec<base16::LowercaseAlphabet, 4>;
+    static_assert(Codec::chars_per_group == 2, "");
+    static_assert(Codec::bytes_per_group == 1, "");
+    static_assert(Codec::max_padding == 0, "");
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len += (len < 100) ? 1 : 23)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            const std::string encoded{ Codec::encode(bytes.data(), len) };
+            ASSERT_EQ(base16::encode_lower(bytes), encoded);
+            ASSERT_EQ(bytes, Codec::decode(encoded.data(), encoded.size()));
+        }
+    });
+
+    // No padding: '=' is an invalid character, an odd length invalid
+    char out[2];
+    BaseXX::DecodeResult result{
+        Codec::try_decode_into(out, sizeof(out), "c0f=", 4) };
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+    ASSERT_EQ(3u, result.offset);
+    ASSERT_EQ(1u, result.written);
+    result = Codec::try_decode_into(
+        out, sizeof(out), "c0f", 3, BaseXX::ePadding::Optional);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidLength, result.code);
+    ASSERT_EQ(2u, result.offset);
+}  // TEST(Base16, codec)
+
+TEST(Codec, scalar_plugin)
+{
+    using Octal = BaseXX::Codec<OctalAlphabet, 3>;
+    static_assert(Octal::chars_per_group == 8, "");
+    static_assert(Octal::bytes_per_group == 3, "");
+    static_assert(Octal::max_padding == 5, "");
+
+    ASSERT_EQ("202=====", Octal::encode("A", 1));
+    ASSERT_EQ("314674==", Octal::encode("fo", 2));
+    ASSERT_EQ("31467557", Octal::encode("foo", 3));
+    ASSERT_EQ("31467557304",
+        Octal::encode("foob", 4, BaseXX::ePadding::None));
+    ASSERT_EQ("foob", Octal::decode("31467557304=====", 16));
+    ASSERT_EQ("fo", Octal::decode("314674", 6, BaseXX::ePadding::Optional));
+
+    const std::string data{ make_bytes(100) };
+    for (size_t len = 0; len <= data.size(); len++)
+    {
+        const std::string encoded{ Octal::encode(data.data(), len) };
+        ASSERT_EQ(data.substr(0, len),
+            Octal::decode(encoded.data(), encoded.size()));
+    }
+
+    // 3 characters hold 1 byte, 4 do not hold a second one
+    ASSERT_EQ(BaseXX::eResultCode::InvalidPaddingCount,
+        Octal::validate("3146====", 8).code);
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter,
+        Octal::validate("31467558", 8).code);
+}  // TEST(Codec, scalar_plugin)
+
+TEST(CustomAlphabet, builtin)
+{
+    const BaseXX::CustomAlphabet standard{ std::string(
+        base64::encoding_table, base64::encoding_table + 64) };
+    const BaseXX::CustomAlphabet hex{ std::string(
+        base32::hex_encoding_table, base32::hex_encoding_table + 32) };
+    const BaseXX::CustomAlphabet lower{ "0123456789abcdef" };
+    ASSERT_EQ(6u, standard.bits_per_char());
+    ASSERT_EQ(32u, hex.size());
+    ASSERT_EQ(4u, lower.bits_per_char());
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(300) };
+        for (size_t len = 0; len <= 300; len += (len < 100) ? 1 : 23)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+
+            const std::string encoded64{ standard.encode(bytes) };
+            ASSERT_EQ(base64::encode(bytes), encoded64);
+            ASSERT_EQ(bytes, standard.decode(encoded64));
+
+            const std::string encoded32{ hex.encode(bytes) };
+            ASSERT_EQ(base32::encode_hex(bytes), encoded32);
+            ASSERT_EQ(bytes, hex.decode(encoded32));
+
+            const std::string encoded16{ lower.encode(bytes) };
+            ASSERT_EQ(base16::encode_lower(bytes), encoded16);
+            ASSERT_EQ(bytes, lower.decode(encoded16));
+            ASSERT_EQ(len, lower.validate(
+                encoded16.data(), encoded16.size()).written);
+        }
+
+        // Same error, at the same offset, as the built-in decoders
+        std::string text{ base64::encode(data) };
+        text[177] = '-';
+        std::string out(300, '\0');
+        const BaseXX::DecodeResult expected{ base64::try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        const BaseXX::DecodeResult result{ standard.try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        ASSERT_EQ(expected.code, result.code);
+        ASSERT_EQ(177u, result.offset);
+        ASSERT_EQ(expected.written, result.written);
+        ASSERT_EQ(result.code,
+            standard.validate(text.data(), text.size()).code);
+        ASSERT_FALSE(standard.is_valid(text));
+    });
+}  // TEST(CustomAlphabet, builtin)
+
+TEST(CustomAlphabet, base64)
+{
+    // bcrypt & crypt(3): unpadded, '.' and '/' in front
+    const std::string bcrypt_chars{
+        "./ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789" };
+    const BaseXX::CustomAlphabet bcrypt{
+        bcrypt_chars, BaseXX::ePadding::None };
+
+    // IMAP mailbox names (RFC 3501): ',' in place of '/'
+    const BaseXX::CustomAlphabet imap{
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+,",
+        BaseXX::ePadding::None };
+    ASSERT_EQ("Jjo", imap.encode({ 0x26, 0x3A }));            // U+263A
+    ASSERT_EQ("U,BTFw", imap.encode({ 0x53, 0xF0, 0x53, 0x17 }));
+    ASSERT_EQ(std::string("\x53\xF0\x53\x17"), imap.decode("U,BTFw"));
+    ASSERT_THROW(imap.decode("U/BTFw"), std::runtime_error);
+    ASSERT_THROW(imap.decode("Jjo="), std::runtime_error);
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(500, 7) };
+        for (size_t len = 0; len <= 500; len += (len < 100) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+            std::string expected{ reference_encode(bytes,
+                reinterpret_cast<const uint8_t*>(bcrypt_chars.data()), 6) };
+            expected.erase(expected.find_last_not_of('=') + 1);
+
+            const std::string encoded{ bcrypt.encode(bytes) };
+            ASSERT_EQ(expected, encoded);
+            ASSERT_EQ(bytes, bcrypt.decode(encoded));
+            ASSERT_TRUE(bcrypt.is_valid(encoded));
+        }
+
+        // '+' is not in the bcrypt alphabet
+        std::string text{ bcrypt.encode(data) };
+        text[450] = '+';
+        ASSERT_EQ(450u, bcrypt.validate(text.data(), text.size()).offset);
+        ASSERT_THROW(bcrypt.decode(text), std::runtime_error);
+    });
+}  // TEST(CustomAlphabet, base64)
+
+TEST(CustomAlphabet, base32)
+{
+    // Crockford's Base32: no I, L, O or U; either case, O for 0, I & L for 1
+    std::string aliases{ "O0o0I1i1L1l1" };
+    const std::string crockford_chars{ "0123456789ABCDEFGHJKMNPQRSTVWXYZ" };
+    for (const char c : crockford_chars)
+    {
+        if (std::isupper(static_cast<unsigned char>(c)))
+        {
+            aliases += static_cast<char>(std::tolower(c));
+            aliases += c;
+        }
+    }
+    const BaseXX::CustomAlphabet crockford{
+        crockford_chars, BaseXX::ePadding::None, aliases };
+    ASSERT_EQ("CSQPYRK1E8", crockford.encode("foobar"));
+    ASSERT_EQ("foobar", crockford.decode("csqpyrkle8"));
+    ASSERT_EQ(std::string(5, '\0'), crockford.decode("0Oo00ooO"));
+
+    // A vendor's shuffle of the RFC 4648 alphabet, padded
+    const std::string vendor_chars{ "QAZ2WSX3EDC4RFV5TGB6YHN7UJMKIOLP" };
+    const BaseXX::CustomAlphabet vendor{ vendor_chars };
+
+    for_each_simd_level([&]()
+    {
+        const std::string data{ make_bytes(500, 11) };
+        for (size_t len = 0; len <= 500; len += (len < 100) ? 1 : 37)
+        {
+            SCOPED_TRACE(len);
+            const std::string bytes{ data.substr(0, len) };
+
+            const std::string encoded{ vendor.encode(bytes) };
+            ASSERT_EQ(reference_encode(bytes,
+                reinterpret_cast<const uint8_t*>(vendor_chars.data()), 5),
+                encoded);
+            ASSERT_EQ(bytes, vendor.decode(encoded));
+
+            // Aliases go through the kernels too
+            std::string text{ crockford.encode(bytes) };
+            ASSERT_EQ(bytes, crockford.decode(text));
+            std::transform(text.begin(), text.end(), text.begin(),
+                [](const char c)
+                {
+                    return (c == '0') ? 'o' : (c == '1') ? 'L'
+                        : static_cast<char>(
+                            std::tolower(static_cast<unsigned char>(c)));
+                });
+            ASSERT_EQ(bytes, crockford.decode(text));
+        }
+
+        std::string text{ vendor.encode(data) };
+        text[401] = '8';  // not in the alphabet
+        std::string out(500, '\0');
+        const BaseXX::DecodeResult result{ vendor.try_decode_into(
+            &out[0], out.size(), text.data(), text.size()) };
+        ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter, result.code);
+        ASSERT_EQ(401u, result.offset);
+        ASSERT_EQ(250u, result.written);
+    });
+}  // TEST(CustomAlphabet, base32)
+
+TEST(CustomAlphabet, invalid)
+{
+    using BaseXX::eResultCode;
+    const std::string base32_chars{ "ABCDEFGHIJKLMNOPQRSTUVWXYZ234567" };
+
+    ASSERT_EQ(eResultCode::Success, BaseXX::CustomAlphabet::check(
+        base32_chars, "aAbB"));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,
+        BaseXX::CustomAlphabet::check(base32_chars.substr(1)));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,  // 'A' twice
+        BaseXX::CustomAlphabet::check("ABCDEFGHIJKLMNOA"));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,  // the padding
+        BaseXX::CustomAlphabet::check("ABCDEFGHIJKLMNO="));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,
+        BaseXX::CustomAlphabet::check("ABCDEFGHIJKLMNO "));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,
+        BaseXX::CustomAlphabet::check("ABCDEFGHIJKLMNO\xC3"));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,  // odd alias list
+        BaseXX::CustomAlphabet::check(base32_chars, "a"));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,  // alias in the alphabet
+        BaseXX::CustomAlphabet::check(base32_chars, "B2"));
+    ASSERT_EQ(eResultCode::InvalidAlphabet,  // target outside of it
+        BaseXX::CustomAlphabet::check(base32_chars, "a8"));
+
+    ASSERT_THROW(BaseXX::CustomAlphabet{ "0123456789" }, std::runtime_error);
+    ASSERT_STREQ("Invalid alphabet.",
+        BaseXX::result_message(eResultCode::InvalidAlphabet));
+}  // TEST(CustomAlphabet, invalid)
+
+TEST(Codec, validate_agrees)
+{
+    // validate() & is_valid() pass exactly the texts a decode accepts and
+    // report the same code & offset for the others
+    const BaseXX::CustomAlphabet reversed{
+        "/+9876543210zyxwvutsrqponmlkjihgfedcbaZYXWVUTSRQPONMLKJIHGFEDCBA" };
+    const BaseXX::CustomAlphabet crockford{
+        "0123456789ABCDEFGHJKMNPQRSTVWXYZ" };
+
+    for_each_simd_level([&]()
+    {
+        std::string out{};
+        for (size_t len = 0; len <= 10; len++)
+        {
+            const std::string bytes{ make_bytes(len, 3) };
+
+            for (const auto& text : corruptions(base64::encode(bytes), "=!A"))
+            {
+                SCOPED_TRACE(text);
+                const BaseXX::DecodeResult result{
+                    base64::try_decode(text, out) };
+                const BaseXX::DecodeResult checked{
+                    base64::validate(text.data(), text.size()) };
+                ASSERT_EQ(result.code, checked.code);
+                ASSERT_EQ(result.offset, checked.offset);
+                ASSERT_EQ(static_cast<bool>(result), base64::is_valid(text));
+            }
+
+            for (const auto& text : corruptions(base32::encode(bytes), "=!A"))
+            {
+                SCOPED_TRACE(text);
+                const BaseXX::DecodeResult result{
+                    base32::try_decode(text, out) };
+                const BaseXX::DecodeResult checked{
+                    base32::validate(text.data(), text.size()) };
+                ASSERT_EQ(result.code, checked.code);
+                ASSERT_EQ(result.offset, checked.offset);
+                ASSERT_EQ(static_cast<bool>(result), base32::is_valid(text));
+            }
+
+            for (const auto& text : corruptions(base16::encode(bytes), "=!A"))
+            {
+                SCOPED_TRACE(text);
+                const BaseXX::DecodeResult result{
+                    base16::try_decode(text, out) };
+                const BaseXX::DecodeResult checked{
+                    base16::validate(text.data(), text.size()) };
+                ASSERT_EQ(result.code, checked.code);
+                ASSERT_EQ(result.offset, checked.offset);
+                ASSERT_EQ(static_cast<bool>(result), base16::is_valid(text));
+            }
+
+            for (const auto& alphabet : { &reversed, &crockford })
+            {
+                for (const auto& text :
+                    corruptions(alphabet->encode(bytes), "=!A"))
+                {
+                    SCOPED_TRACE(text);
+                    out.assign(text.size(), '\0');
+                    const BaseXX::DecodeResult result{
+                        alphabet->try_decode_into(
+                            &out[0], out.size(), text.data(), text.size()) };
+                    const BaseXX::DecodeResult checked{
+                        alphabet->validate(text.data(), text.size()) };
+                    ASSERT_EQ(result.code, checked.code);
+                    ASSERT_EQ(result.offset, checked.offset);
+                    ASSERT_EQ(static_cast<bool>(result),
+                        alphabet->is_valid(text));
+                }
+            }
+        }
+    });
+
+    std::string out{};
+    ASSERT_EQ(BaseXX::eResultCode::InvalidCharacter,
+        base64::try_decode("Zg=!", out).code);
+    ASSERT_EQ(2u, base64::try_decode("Zg=!", out).offset);
+    ASSERT_FALSE(base32::try_decode("MY=====!", out));
+    ASSERT_FALSE(base64::try_decode("Zg==Zg==", out));
+}  // TEST(Codec, validate_agrees)
+
+TEST(Dispatch, simd_level)
+{
+    const BaseXX::eSimdLevel saved{ BaseXX::simd_level() };
+
+    ASSERT_LE(saved, BaseXX::max_simd_level());
+    ASSERT_EQ(BaseXX::eSimdLevel::Scalar,
+        BaseXX::set_simd_level(BaseXX::eSimdLevel::Scalar));
+    ASSERT_EQ(BaseXX::eSimdLevel::Scalar, BaseXX::simd_level());
+
+    // Requests above what the CPU supports are clamped
+    ASSERT_EQ(BaseXX::max_simd_level(),
+        BaseXX::set_simd_level(BaseXX::eSimdLevel::AVX512BW));
+    ASSERT_EQ(BaseXX::max_simd_level(), BaseXX::simd_level());
+
+    ASSERT_STREQ("scalar",
+        BaseXX::simd_level_name(BaseXX::eSimdLevel::Scalar));
+    ASSERT_STREQ("avx2", BaseXX::simd_level_name(BaseXX::eSimdLevel::AVX2));
+
+    BaseXX::set_simd_level(saved);
+}  // TEST(Dispatch, simd_level)
+
+TEST(Dispatch, scalar_words)
+{
+    // The SWAR words of the scalar level alone, for every built-in alphabet
+    const BaseXX::eSimdLevel saved{ BaseXX::simd_level() };
+    BaseXX::set_simd_level(BaseXX::eSimdLevel::Scalar);
+
+    const std::string data{ make_bytes(200) };
+    for (size_t len = 0; len <= data.size(); len++)
+    {
+        SCOPED_TRACE(len);
+        const std::string bytes{ data.substr(0, len) };
+
+        std::string text{ base64::encode(bytes) };
+        ASSERT_EQ(reference_encode(bytes, base64::encoding_table, 6), text);
+        ASSERT_EQ(bytes, base64::decode(text));
+        text = base64::encode_urlsafe(bytes);
+        ASSERT_EQ(
+            reference_encode(bytes, base64::urlsafe_encoding_table, 6), text);
+        ASSERT_EQ(bytes, base64::decode_urlsafe(text));
+
+        text = base32::encode(bytes);
+        ASSERT_EQ(reference_encode(bytes, base32::encoding_table, 5), text);
+        ASSERT_EQ(bytes, base32::decode(text));
+        text = base32::encode_hex(bytes);
+        ASSERT_EQ(
+            reference_encode(bytes, base32::hex_encoding_table, 5), text);
+        ASSERT_EQ(bytes, base32::decode_hex(text));
+
+        text = base16::encode(bytes);
+        ASSERT_EQ(reference_encode(bytes, base16::encoding_table, 4), text);
+        ASSERT_EQ(bytes, base16::decode(text));
+        text = base16::encode_lower(bytes);
+        ASSERT_EQ(
+            reference_encode(bytes, base16::lowercase_encoding_table, 4), text);
+        ASSERT_EQ(bytes, base16::decode_any_case(text));
+    }
+
+    // A character of the sibling alphabet at every offset
+    std::string out{};
+    for (size_t bad = 0; bad < 256; bad++)
+    {
+        SCOPED_TRACE(bad);
+
+        std::string text{ base64::encode(data) };
+        text[bad] = '-';
+        ASSERT_EQ(bad, base64::try_decode(text, out).offset);
+        ASSERT_FALSE(base64::is_valid(text));
+        text = base64::encode_urlsafe(data);
+        text[bad] = '/';
+        ASSERT_EQ(bad, base64::try_decode_urlsafe(text, out).offset);
+        ASSERT_FALSE(base64::is_valid_urlsafe(text));
+
+        text = base32::encode(data);
+        text[bad] = '0';
+        ASSERT_EQ(bad, base32::try_decode(text, out).offset);
+        ASSERT_FALSE(base32::is_valid(text));
+        text = base32::encode_hex(data);
+        text[bad] = 'W';
+        ASSERT_EQ(bad, base32::try_decode_hex(text, out).offset);
+        ASSERT_FALSE(base32::is_valid_hex(text));
+
+        text = base16::encode(data);
+        text[bad] = 'a';
+        ASSERT_EQ(bad, base16::try_decode(text, out).offset);
+        ASSERT_FALSE(base16::is_valid(text));
+        text = base16::encode_lower(data);
+        text[bad] = 'g';
+        ASSERT_EQ(bad, base16::try_decode_any_case(text, out).offset);
+        ASSERT_FALSE(base16::is_valid_any_case(text));
+    }
+
+    BaseXX::set_simd_level(saved);
+}  // TEST(Dispatch, scalar_words)
@@ -0,0 +1,584 @@
+/// ============================================================================
+/// basexx.cpp
+/// ----------------------------------------------------------------------------
+/// Command-line front end of BaseXX.h
+///
+///     basexx [-64 | -64url | -32 | -32hex | -16] [-d] [-t threads]
+///            [-w cols] [file]
+///
+/// Regular files are memory-mapped, stdin & pipes are read with fread().
+/// Either way the input goes through in chunks of about 2 MiB per thread,
+/// so input & output stay cache-sized, and the output is written in
+/// 1 MiB blocks.
+/// ============================================================================
+
+#include "BaseXX.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <string>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define BASEXX_TOOL_MMAP
+    #include <fcntl.h>  // open
+    #include <sys/mman.h>  // mmap, munmap, madvise
+    #include <sys/stat.h>  // fstat
+    #include <unistd.h>  // close
+#endif  // defined(__unix__) || defined(__APPLE__)
+
+#if defined(_WIN32)
+    #include <fcntl.h>  // _O_BINARY
+    #include <io.h>  // _setmode, _fileno
+#endif  // defined(_WIN32)
+
+
+namespace
+{
+    enum class eCodec
+    {
+        Base64,
+        Base64Url,
+        Base32,
+        Base32Hex,
+        Base16,
+    };
+
+    struct Options
+    {
+        eCodec codec = eCodec::Base64;
+        bool decode = false;
+        size_t threads = 1;  // 0: one per hardware thread
+        size_t wrap = 76;    // 0: no line breaks
+        const char* path = nullptr;  // nullptr or "-": stdin
+    };
+
+    /// Size of the output blocks handed to fwrite().
+    constexpr size_t output_block = 1 << 20;
+
+    /// Input chunk per thread: a multiple of 3, 5 & 8, so only the last
+    /// chunk of an encoded stream ends in padding. Over
+    /// BaseXX::parallel_min_slice, so that every thread gets a slice.
+    constexpr size_t input_chunk = 120 << 14;
+
+    void usage(FILE* out)
+    {
+        std::fputs(
+            "Usage: basexx [OPTION]... [FILE]\n"
+            "Encode or decode FILE (or stdin) to stdout.\n"
+            "\n"
+            "  -64        Base64 (default)\n"
+            "  -64url     Base64 with the URL and filename safe alphabet\n"
+            "  -32        Base32\n"
+            "  -32hex     Base32 with the extended hex alphabet\n"
+            "  -16        Base16\n"
+            "  -d         decode; line breaks in the input are skipped\n"
+            "  -t N       use N threads (0: all hardware threads)\n"
+            "  -w COLS    wrap encoded lines after COLS characters\n"
+            "             (default 76, 0 disables wrapping)\n"
+            "  -h         display this help and exit\n",
+            out);
+    }
+
+    bool parse_count(const char* text, size_t& value)
+    {
+        if (text == nullptr || *text == '\0')
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        const unsigned long long parsed = std::strtoull(text, &end, 10);
+        if (*end != '\0' || text[0] == '-')
+        {
+            return false;
+        }
+
+        value = static_cast<size_t>(parsed);
+        return true;
+    }
+
+    /// Returns false on a malformed command line.
+    bool parse_args(int argc, char* argv[], Options& options)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string arg{ argv[i] };
+            if (arg == "-64")
+            {
+                options.codec = eCodec::Base64;
+            }
+            else if (arg == "-64url")
+            {
+                options.codec = eCodec::Base64Url;
+            }
+            else if (arg == "-32")
+            {
+                options.codec = eCodec::Base32;
+            }
+            else if (arg == "-32hex")
+            {
+                options.codec = eCodec::Base32Hex;
+            }
+            else if (arg == "-16")
+            {
+                options.codec = eCodec::Base16;
+            }
+            else if (arg == "-d")
+            {
+                options.decode = true;
+            }
+            else if (arg == "-t" || arg == "-w")
+            {
+                size_t& value = (arg == "-t") ? options.threads : options.wrap;
+                if (!parse_count((i + 1 < argc) ? argv[++i] : nullptr, value))
+                {
+                    return false;
+                }
+            }
+            else if (arg == "-h" || arg == "--help")
+            {
+                usage(stdout);
+                std::exit(EXIT_SUCCESS);
+            }
+            else if (arg.size() > 1 && arg[0] == '-')
+            {
+                return false;
+            }
+            else if (options.path == nullptr)
+            {
+                options.path = argv[i];
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    [[noreturn]]
+    void fail(const std::string& message)
+    {
+        std::fputs(("basexx: " + message + "\n").c_str(), stderr);
+        std::exit(EXIT_FAILURE);
+    }
+
+    /// Buffered stdout that optionally breaks lines every `wrap` characters.
+    class Writer
+    {
+    public:
+        explicit Writer(const size_t wrap)
+            : wrap_(wrap)
+        {
+            buffer_.reserve(output_block + output_block / 64 + 1);
+        }
+
+        void write(const char* data, size_t len)
+        {
+            if (wrap_ == 0)
+            {
+                if (len >= output_block)
+                {
+                    flush();
+                    put(data, len);
+                    return;
+                }
+
+                buffer_.append(data, len);
+            }
+            else
+            {
+                while (len > 0)
+                {
+                    const size_t take = (wrap_ - column_ < len)
+                        ? wrap_ - column_
+                        : len;
+                    buffer_.append(data, take);
+                    data += take;
+                    len -= take;
+                    column_ += take;
+                    if (column_ == wrap_)
+                    {
+                        buffer_ += '\n';
+                        column_ = 0;
+                    }
+
+                    if (buffer_.size() >= output_block)
+                    {
+                        flush();
+                    }
+                }
+            }
+
+            if (buffer_.size() >= output_block)
+            {
+                flush();
+            }
+        }
+
+        /// Terminate a partial line and write out whatever is buffered.
+        void finish()
+        {
+            if (wrap_ != 0 && column_ != 0)
+            {
+                buffer_ += '\n';
+                column_ = 0;
+            }
+            flush();
+
+            if (std::fflush(stdout) != 0)
+            {
+                fail("write error");
+            }
+        }
+
+    private:
+        void flush()
+        {
+            put(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+
+        static void put(const char* data, const size_t len)
+        {
+            if (len != 0 && std::fwrite(data, 1, len, stdout) != len)
+            {
+                fail("write error");
+            }
+        }
+
+        std::string buffer_{};
+        size_t wrap_;
+        size_t column_ = 0;
+    };
+
+    size_t encoded_length(const eCodec codec, const size_t len)
+    {
+        switch (codec)
+        {
+        case eCodec::Base64:
+        case eCodec::Base64Url:
+            return base64::encoded_length(len);
+        case eCodec::Base32:
+        case eCodec::Base32Hex:
+            return base32::encoded_length(len);
+        default:
+            return base16::encoded_length(len);
+        }
+    }
+
+    size_t encode(const eCodec codec, char* dst, const size_t dst_cap,
+        const char* data, const size_t len, const size_t threads)
+    {
+        switch (codec)
+        {
+        case eCodec::Base64:
+            return base64::encode_parallel_into(
+                dst, dst_cap, data, len, threads);
+        case eCodec::Base64Url:
+            return base64::encode_parallel_into(dst, dst_cap, data, len,
+                threads, base64::urlsafe_encoding_table);
+        case eCodec::Base32:
+            return base32::encode_parallel_into(
+                dst, dst_cap, data, len, threads);
+        case eCodec::Base32Hex:
+            return base32::encode_parallel_into(dst, dst_cap, data, len,
+                threads, base32::hex_encoding_table);
+        default:
+            return base16::encode_parallel_into(
+                dst, dst_cap, data, len, threads);
+        }
+    }
+
+    BaseXX::DecodeResult decode(const eCodec codec, char* dst,
+        const size_t dst_cap, const char* data, const size_t len,
+        const size_t threads)
+    {
+        switch (codec)
+        {
+        case eCodec::Base64:
+            return base64::try_decode_parallel_into(
+                dst, dst_cap, data, len, threads);
+        case eCodec::Base64Url:
+            return base64::try_decode_parallel_into(dst, dst_cap, data, len,
+                threads, &base64::urlsafe_decode_value);
+        case eCodec::Base32:
+            return base32::try_decode_parallel_into(
+                dst, dst_cap, data, len, threads);
+        case eCodec::Base32Hex:
+            return base32::try_decode_parallel_into(dst, dst_cap, data, len,
+                threads, &base32::hex_decode_value);
+        default:
+            return base16::try_decode_parallel_into<base16::AnyCaseAlphabet>(
+                dst, dst_cap, data, len, threads);
+        }
+    }
+
+    /// Sequential chunks of a memory-mapped file or of a stream.
+    class Input
+    {
+    public:
+        explicit Input(FILE* stream)
+            : stream_(stream)
+        {
+        }
+
+        Input(const char* data, const size_t len)
+            : data_(data), len_(len)
+        {
+        }
+
+        /// Point `chunk` at the next `max` bytes, fewer only at the end of
+        /// the input; returns their number, 0 once everything was read.
+        size_t next(const char*& chunk, const size_t max)
+        {
+            if (stream_ == nullptr)
+            {
+                const size_t len = (len_ - pos_ < max) ? len_ - pos_ : max;
+                chunk = data_ + pos_;
+                pos_ += len;
+
+                return len;
+            }
+
+            buffer_.resize(max);
+            const size_t len = std::fread(&buffer_[0], 1, max, stream_);
+            if (len < max && std::ferror(stream_))
+            {
+                fail("read error");
+            }
+            chunk = buffer_.data();
+
+            return len;
+        }
+
+    private:
+        FILE* stream_ = nullptr;
+        const char* data_ = nullptr;
+        size_t len_ = 0;
+        size_t pos_ = 0;
+        std::string buffer_{};
+    };
+
+    void decode_error(const BaseXX::DecodeResult& result, size_t offset)
+    {
+        fail(std::string("invalid input: ") +
+             BaseXX::result_message(result.code) +
+             " (offset: " + std::to_string(offset + result.offset) + ")");
+    }
+
+    /// Append `data` to `out` without CR/LF.
+    void append_stripped(std::string& out, const char* data, size_t len)
+    {
+        while (len > 0)
+        {
+            const char* const lf =
+                static_cast<const char*>(std::memchr(data, '\n', len));
+            size_t line = (lf != nullptr) ? static_cast<size_t>(lf - data)
+                                          : len;
+            const size_t next = (lf != nullptr) ? line + 1 : len;
+            if (line > 0 && data[line - 1] == '\r')
+            {
+                line--;
+            }
+
+            out.append(data, line);
+            data += next;
+            len -= next;
+        }
+    }
+
+    void encode_input(const Options& options, const size_t threads,
+        Input& input, Writer& writer)
+    {
+        // Every chunk but the last one is a whole number of groups.
+        const size_t chunk_len = input_chunk * threads;
+        std::string out(encoded_length(options.codec, chunk_len), '\0');
+
+        const char* chunk = nullptr;
+        size_t len = 0;
+        while ((len = input.next(chunk, chunk_len)) != 0)
+        {
+            writer.write(out.data(), encode(options.codec,
+                &out[0], out.size(), chunk, len, threads));
+        }
+    }
+
+    /// Line breaks are dropped and the text is decoded in whole groups of
+    /// 8 characters as it accumulates. Offsets in error messages count
+    /// characters without line breaks.
+    void decode_input(const Options& options, const size_t threads,
+        Input& input, Writer& writer)
+    {
+        const size_t chunk_len = input_chunk * threads;
+        std::string text{};
+        std::string out{};
+        size_t offset = 0;  // characters decoded so far
+
+        const char* chunk = nullptr;
+        size_t len = 0;
+        while ((len = input.next(chunk, chunk_len)) != 0)
+        {
+            append_stripped(text, chunk, len);
+            if (text.size() <= chunk_len)
+            {
+                continue;
+            }
+
+            // Keep the last group back, it may hold the padding.
+            const size_t whole = (text.size() - 1) / 8 * 8;
+            out.resize(whole);
+            const BaseXX::DecodeResult result = decode(options.codec,
+                &out[0], out.size(), text.data(), whole, threads);
+            if (!result)
+            {
+                decode_error(result, offset);
+            }
+
+            // Padding ended the text early, yet more of it follows
+            const void* const padding = std::memchr(text.data(), '=', whole);
+            if (padding != nullptr)
+            {
+                const size_t pos = static_cast<size_t>(
+                    static_cast<const char*>(padding) - text.data());
+                decode_error(BaseXX::DecodeResult{
+                    BaseXX::eResultCode::InvalidCharacter, pos, 0 }, offset);
+            }
+
+            writer.write(out.data(), result.written);
+            text.erase(0, whole);
+            offset += whole;
+        }
+
+        out.resize(text.size());
+        const BaseXX::DecodeResult result = decode(options.codec,
+            &out[0], out.size(), text.data(), text.size(), threads);
+        if (!result)
+        {
+            decode_error(result, offset);
+        }
+        writer.write(out.data(), result.written);
+    }
+
+    void process(const Options& options, Input& input)
+    {
+        size_t threads = options.threads;
+        if (threads == 0)
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+        threads = (threads > 0) ? threads : 1;
+
+        Writer writer{ options.decode ? 0 : options.wrap };
+        if (options.decode)
+        {
+            decode_input(options, threads, input, writer);
+        }
+        else
+        {
+            encode_input(options, threads, input, writer);
+        }
+        writer.finish();
+    }
+
+#if defined(BASEXX_TOOL_MMAP)
+    /// Map a regular file read-only; false when it can't be mapped.
+    bool process_mapped(const Options& options, const int fd)
+    {
+        struct stat info{};
+        if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode) ||
+            info.st_size <= 0)
+        {
+            return false;
+        }
+
+        const size_t len = static_cast<size_t>(info.st_size);
+        void* const mapped = mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapped == MAP_FAILED)
+        {
+            return false;
+        }
+        madvise(mapped, len, MADV_SEQUENTIAL);
+
+        Input input{ static_cast<const char*>(mapped), len };
+        process(options, input);
+        munmap(mapped, len);
+
+        return true;
+    }
+#endif  // defined(BASEXX_TOOL_MMAP)
+
+    void run(const Options& options)
+    {
+        const bool use_stdin = (options.path == nullptr ||
+                                std::strcmp(options.path, "-") == 0);
+
+#if defined(BASEXX_TOOL_MMAP)
+        if (!use_stdin)
+        {
+            const int fd = open(options.path, O_RDONLY);
+            if (fd < 0)
+            {
+                fail(std::string(options.path) + ": " + std::strerror(errno));
+            }
+
+            const bool mapped = process_mapped(options, fd);
+            close(fd);
+            if (mapped)
+            {
+                return;
+            }
+        }
+#endif  // defined(BASEXX_TOOL_MMAP)
+
+        FILE* stream = stdin;
+        if (!use_stdin)
+        {
+            stream = std::fopen(options.path, "rb");
+            if (stream == nullptr)
+            {
+                fail(std::string(options.path) + ": " + std::strerror(errno));
+            }
+        }
+
+        Input input{ stream };
+        process(options, input);
+
+        if (stream != stdin)
+        {
+            std::fclose(stream);
+        }
+    }
+}  // namespace
+
+
+int main(int argc, char* argv[])
+{
+    Options options{};
+    if (!parse_args(argc, argv, options))
+    {
+        usage(stderr);
+        return EXIT_FAILURE;
+    }
+
+#if defined(_WIN32)
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif  // defined(_WIN32)
+
+    try
+    {
+        run(options);
+    }
+    catch (const std::exception& e)
+    {
+        fail(e.what());
+    }
+
+    return EXIT_SUCCESS;
+}